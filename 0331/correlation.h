@@ -0,0 +1,130 @@
+#ifndef INC_0331_CORRELATION_H
+#define INC_0331_CORRELATION_H
+
+#include <vector>
+#include <math.h>
+
+using namespace std;
+
+/*
+ * غźǿȵļģ㾫ģReal
+ *   double˳ۼӣΪο
+ *   float ÿBLOCKΪһ飬LANES·ֺۼӣSIMD֮Kahan
+ * floatģʽ磨u = 2^-24  6e-8
+ *   | - doubleοֵ| <= (BLOCK/LANES + 8) * u * |ÿһ|
+ * 8uתΪfloat˷·ϲKahanͱг޹ءBLOCK=256LANES=8ʱԼΪ2.4e-6 * |ÿһ|
+ * ǿȵÿһ2.4e-6ֵ|ÿһ|
+ * 10^7ʵ⣺ǿԼ2e-8ֵԼ1e-10 * |ÿһ|
+ */
+
+/* ŵĸ */
+template<typename Real>
+struct Samples {
+    vector<Real> re; // ʵ
+    vector<Real> im; // 鲿
+    int size() const { return re.size(); };
+};
+
+// ȡ[begin, end)һ
+template<typename Real>
+Samples<Real> slice(const Samples<Real> &x, int begin, int end) {
+    Samples<Real> part;
+    part.re.assign(x.re.begin() + begin, x.re.begin() + end);
+    part.im.assign(x.im.begin() + begin, x.im.begin() + end);
+    return part;
+}
+
+/* Kahan */
+template<typename Real>
+class KahanSum {
+public:
+    KahanSum() : sum(0), c(0) {};
+    void add(Real x) {
+        Real y = x - c;
+        Real t = sum + y;
+        c = (t - sum) - y;
+        sum = t;
+    };
+    Real value() const { return sum; };
+private:
+    Real sum; // ǰĺ
+    Real c; // ʧĵλ
+};
+
+template<typename Real>
+struct CorrelationKernel {
+    //  (a.re[i]*b.re[i+k] + a.im[i]*b.im[i+k])
+    static double dot(const Samples<Real> &a, const Samples<Real> &b, int k) {
+        double sum = 0;
+        for(int i = 0; i < a.size(); i++)
+            sum += a.re[i] * b.re[i + k] + a.im[i] * b.im[i + k];
+        return sum;
+    };
+    //  |x[i]|
+    static double modulusSum(const Samples<Real> &x) {
+        double sum = 0;
+        for(int i = 0; i < x.size(); i++)
+            sum += sqrt(x.re[i] * x.re[i] + x.im[i] * x.im[i]);
+        return sum;
+    };
+};
+
+template<>
+struct CorrelationKernel<float> {
+    static const int BLOCK = 256; // ÿ
+    static const int LANES = 8; // ڵĲֺ·
+
+    static double dot(const Samples<float> &a, const Samples<float> &b, int k) {
+        const float* ar = a.re.data();
+        const float* ai = a.im.data();
+        const float* br = b.re.data() + k;
+        const float* bi = b.im.data() + k;
+        int n = a.size();
+        KahanSum<float> total;
+        for(int start = 0; start < n; start += BLOCK) {
+            int end = min(start + BLOCK, n);
+            float lane[LANES] = {0};
+            int i = start;
+            for(; i + LANES <= end; i += LANES) {
+                for(int j = 0; j < LANES; j++)
+                    lane[j] += ar[i + j] * br[i + j] + ai[i + j] * bi[i + j];
+            }
+            for(; i < end; i++)
+                lane[0] += ar[i] * br[i] + ai[i] * bi[i];
+            total.add(reduceLanes(lane));
+        }
+        return total.value();
+    };
+
+    static double modulusSum(const Samples<float> &x) {
+        const float* re = x.re.data();
+        const float* im = x.im.data();
+        int n = x.size();
+        KahanSum<float> total;
+        for(int start = 0; start < n; start += BLOCK) {
+            int end = min(start + BLOCK, n);
+            float lane[LANES] = {0};
+            int i = start;
+            for(; i + LANES <= end; i += LANES) {
+                for(int j = 0; j < LANES; j++)
+                    lane[j] += sqrtf(re[i + j] * re[i + j] + im[i + j] * im[i + j]);
+            }
+            for(; i < end; i++)
+                lane[0] += sqrtf(re[i] * re[i] + im[i] * im[i]);
+            total.add(reduceLanes(lane));
+        }
+        return total.value();
+    };
+
+private:
+    // ϲ·ֺ
+    static float reduceLanes(float* lane) {
+        for(int width = LANES / 2; width > 0; width /= 2) {
+            for(int j = 0; j < width; j++)
+                lane[j] += lane[j + width];
+        }
+        return lane[0];
+    };
+};
+
+#endif //INC_0331_CORRELATION_H
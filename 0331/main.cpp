@@ -4,6 +4,9 @@
 #include <vector>
 #include <iomanip>
 #include <algorithm>
+#include "resultCache.h"
+#include "correlation.h"
+#include "shardSearch.h"
 
 using namespace std;
 
@@ -18,25 +21,69 @@ public:
     ~Complex() {}; // 
 };
 
-double inner_product(Complex z1, Complex z2); // ڻ
 void readDataSet(vector<vector<Complex>> &dataset, string type); // ȡ
-void getIntensity(vector<vector<Complex>> &dataset); // źǿ
-void correlationAnalyze(vector<vector<Complex>> &dataset, vector<vector<Complex>> &pssset); // ؼ
-double getCorrelationValue(int k, int idx, int pos, vector<vector<Complex>> &dataset, vector<vector<Complex>> &pssset); // 㵥ֵ
+template<typename Real>
+void cellSearch(vector<vector<Complex>> &dataset, vector<vector<Complex>> &pssset, vector<CellResult> &results,
+                int workers); // ָȽм
+template<typename Real>
+Samples<Real> toSamples(vector<Complex> &data); // תΪŵ
+template<typename Real>
+void getIntensity(vector<vector<Complex>> &dataset, vector<Samples<Real>> &dataSamples, vector<CellResult> &results); // źǿ
+template<typename Real>
+void correlationAnalyze(vector<vector<Complex>> &dataset, vector<Samples<Real>> &dataSamples,
+                        vector<Samples<Real>> &pssSamples, vector<CellResult> &results); // ؼ
+template<typename Real>
+double getCorrelationValue(int k, Samples<Real> &data, Samples<Real> &pss); // 㵥ֵ
+uint64_t hashCapture(vector<Complex> &data); // ݵĹϣֵ
+uint64_t getConfigHash(vector<vector<Complex>> &dataset, vector<vector<Complex>> &pssset, int precision); // õĹϣֵ
 
-int main() {
+int main(int argc, char* argv[]) {
     vector<vector<Complex>> dataSet; // ݼ
     vector<vector<Complex>> pssSet; // PSS
+    bool useCache = true; // Ƿʹü
+    bool useFloat = false; // Ƿʹõȼ
+    int workers = 1; // 
+    for(int i = 1; i < argc; i++) {
+        if (string(argv[i]) == "--no-cache")
+            useCache = false;
+        else if (string(argv[i]) == "--float")
+            useFloat = true;
+        else if (string(argv[i]) == "--workers" && i + 1 < argc)
+            workers = max(1, atoi(argv[++i]));
+    }
+    int precision = useFloat ? sizeof(float) : sizeof(double);
 
     /* Step-1: ȡdataݺPSS */
     readDataSet(dataSet, "data");
     readDataSet(pssSet, "PSS");
 
-    /* Step-2: źǿȲ */
-    getIntensity(dataSet);
+    /* Step-2: ѯ棬еݲ¼ */
+    vector<CellResult> results(dataSet.size());
+    vector<uint64_t> keys(dataSet.size());
+    ResultCache cache("resultCache.txt", getConfigHash(dataSet, pssSet, precision), pssSet.size());
+    if (useCache) {
+        cache.load();
+        for(int cnt = 0; cnt < dataSet.size(); cnt++) {
+            keys[cnt] = hashCapture(dataSet[cnt]);
+            cache.lookup(keys[cnt], results[cnt]);
+        }
+        cout << "У" << cache.hitCount() << "/" << dataSet.size() << endl << endl;
+    }
 
-    /* Step-3: ؼ */
-    correlationAnalyze(dataSet, pssSet);
+    /* Step-3: źǿȲȻ󻬶ؼ */
+    if (useFloat)
+        cellSearch<float>(dataSet, pssSet, results, workers);
+    else
+        cellSearch<double>(dataSet, pssSet, results, workers);
+
+    /* Step-4: µļ */
+    if (useCache) {
+        for(int cnt = 0; cnt < dataSet.size(); cnt++) {
+            if (!results[cnt].cached)
+                cache.store(keys[cnt], results[cnt]);
+        }
+        cache.save();
+    }
 
     cout << endl << "Over!";
     system("pause");
@@ -50,11 +97,6 @@ Complex::Complex(string id, double re, double im) {
     this->len = sqrt(pow(this->re, 2) + pow(this->im, 2)); // 㸴ģ
 }
 
-// ڻ
-double inner_product(Complex z1, Complex z2) {
-    return z1.re*z2.re + z1.im * z2.im;
-}
-
 // ȡļ
 void readDataSet(vector<vector<Complex>> &dataset, string type)
 {
@@ -82,18 +124,55 @@ void readDataSet(vector<vector<Complex>> &dataset, string type)
     cout << "Success!" << endl << endl;
 }
 
+// ָȽм⣬еݲתworkers1ʱʹö̷Ƭ
+template<typename Real>
+void cellSearch(vector<vector<Complex>> &dataset, vector<vector<Complex>> &pssset, vector<CellResult> &results,
+                int workers) {
+    vector<Samples<Real>> dataSamples(dataset.size());
+    vector<Samples<Real>> pssSamples(pssset.size());
+    for(int cnt = 0; cnt < dataset.size(); cnt++) {
+        if (!results[cnt].valid)
+            dataSamples[cnt] = toSamples<Real>(dataset[cnt]);
+    }
+    for(int pos = 0; pos < pssset.size(); pos++)
+        pssSamples[pos] = toSamples<Real>(pssset[pos]);
+
+    if (workers > 1) {
+        int lagCnt = dataset.size() - pssset.size(); // г
+        vector<NumaNode> nodes = getNumaNodes();
+        cout << "̼⣺" << workers << "̣" << nodes.size() << "NUMAڵ" << endl << endl;
+        if (!shardedSearch(dataSamples, pssSamples, lagCnt, results, workers, nodes))
+            cout << "̼ʧܣΪ̼" << endl << endl;
+    }
+    getIntensity(dataset, dataSamples, results);
+    correlationAnalyze(dataset, dataSamples, pssSamples, results);
+}
+
+// תΪŵ
+template<typename Real>
+Samples<Real> toSamples(vector<Complex> &data) {
+    Samples<Real> samples;
+    samples.re.resize(data.size());
+    samples.im.resize(data.size());
+    for(int i = 0; i < data.size(); i++) {
+        samples.re[i] = data[i].re;
+        samples.im[i] = data[i].im;
+    }
+    return samples;
+}
+
 // źǿ
-void getIntensity(vector<vector<Complex>> &dataset) {
+template<typename Real>
+void getIntensity(vector<vector<Complex>> &dataset, vector<Samples<Real>> &dataSamples, vector<CellResult> &results) {
     int size = dataset.size();
     double intensity[size][2];
     cout << "--------------------ǿ--------------------" << endl;
-    // ǿ
+    // ǿȣеֱʹûеĽ
     for(int cnt = 0; cnt < size; cnt++) {
-        double sum = 0;
-        for(int i = 0; i < dataset[cnt].size(); i++)
-            sum += dataset[cnt][i].len;
+        if (!results[cnt].valid)
+            results[cnt].intensity = CorrelationKernel<Real>::modulusSum(dataSamples[cnt]);
         intensity[cnt][0] = cnt;
-        intensity[cnt][1] = sum;
+        intensity[cnt][1] = results[cnt].intensity;
     }
     // 
     double temp = 0;
@@ -116,45 +195,68 @@ void getIntensity(vector<vector<Complex>> &dataset) {
         cout << "Ϊ" << i + 1 << "" << "С" << intensity[i][0] << "ǿȣ" << intensity[i][1] << endl;
 }
 
-void correlationAnalyze(vector<vector<Complex>> &dataset, vector<vector<Complex>> &pssset) {
+template<typename Real>
+void correlationAnalyze(vector<vector<Complex>> &dataset, vector<Samples<Real>> &dataSamples,
+                        vector<Samples<Real>> &pssSamples, vector<CellResult> &results) {
     cout << endl << "--------------------ؼ--------------------" << endl;
     int dataSetSize = dataset.size();
-    int pssSetSize = pssset.size();
-    double result[dataSetSize][pssSetSize];
+    int pssSetSize = pssSamples.size();
     for(int cnt = 0; cnt < dataSetSize; cnt++) {
-        for(int pos = 0; pos < pssSetSize; pos++) {
-            vector<double> tempCorrelation;
-            int len = dataSetSize - pssSetSize; // г
-            for(int k = 0; k < len; k++)
-                tempCorrelation.push_back(getCorrelationValue(k, cnt, pos, dataset, pssset));
-            // ҵǰеֵ
-            auto maxValue = max_element(tempCorrelation.begin(), tempCorrelation.end());
-            result[cnt][pos] = *maxValue;
-            cout << dataset[cnt][0].id << "PSS" << pos << ".txtԣ" << *maxValue << endl;
+        CellResult &cell = results[cnt];
+        if (!cell.valid) {
+            cell.rootMetric.assign(pssSetSize, 0);
+            for(int pos = 0; pos < pssSetSize; pos++) {
+                vector<double> tempCorrelation;
+                int len = dataSetSize - pssSetSize; // г
+                for(int k = 0; k < len; k++)
+                    tempCorrelation.push_back(getCorrelationValue(k, dataSamples[cnt], pssSamples[pos]));
+                // ҵǰеֵ
+                auto maxValue = max_element(tempCorrelation.begin(), tempCorrelation.end());
+                cell.rootMetric[pos] = *maxValue;
+                if (pos == 0 || *maxValue > cell.metric) {
+                    cell.bestRoot = pos;
+                    cell.timing = maxValue - tempCorrelation.begin();
+                    cell.metric = *maxValue;
+                }
+            }
+            cell.valid = true;
         }
+        for(int pos = 0; pos < pssSetSize; pos++)
+            cout << dataset[cnt][0].id << "PSS" << pos << ".txtԣ" << cell.rootMetric[pos] << endl;
         cout << endl;
     }
     // ҳǿֵ
     int maxResultRow = 0;
-    int maxResultColumn = 0;
-    double tempMaxResult = result[maxResultRow][maxResultColumn];
     for(int i = 0; i < dataSetSize; i++) {
-        for(int j = 0; j < pssSetSize; j++) {
-            if (result[i][j] > tempMaxResult) {
-                maxResultRow = i;
-                maxResultColumn = j;
-                tempMaxResult = result[maxResultRow][maxResultColumn];
-            }
-        }
+        if (results[i].metric > results[maxResultRow].metric)
+            maxResultRow = i;
     }
-    cout << "ǿΪ" << dataset[maxResultRow][0].id << "PSS" << maxResultColumn << ".txt" << "Ϊ"
-         << result[maxResultRow][maxResultColumn] << endl;
+    CellResult &best = results[maxResultRow];
+    cout << "ǿΪ" << dataset[maxResultRow][0].id << "PSS" << best.bestRoot << ".txt" << "Ϊ"
+         << best.metric << "λΪ" << best.timing << endl;
 }
 
 // 㵥ؼֵ
-double getCorrelationValue(int k, int idx, int pos, vector<vector<Complex>> &dataset, vector<vector<Complex>> &pssset) {
-    double sum = 0;
-    for(int i = 0; i < pssset[pos].size(); i++)
-        sum += inner_product(pssset[pos][i], dataset[idx][i+k]);
-    return sum;
-}
\ No newline at end of file
+template<typename Real>
+double getCorrelationValue(int k, Samples<Real> &data, Samples<Real> &pss) {
+    return CorrelationKernel<Real>::dot(pss, data, k);
+}
+
+// ݵĹϣֵֵֻйأļ޹
+uint64_t hashCapture(vector<Complex> &data) {
+    vector<double> buffer(data.size() * 2);
+    for(int i = 0; i < data.size(); i++) {
+        buffer[2 * i] = data[i].re;
+        buffer[2 * i + 1] = data[i].im;
+    }
+    return hashBytes(buffer.data(), buffer.size() * sizeof(double), 0);
+}
+
+// õĹϣֵPSSݡصгȺͼ㾫ȣκһ仯ʹ
+uint64_t getConfigHash(vector<vector<Complex>> &dataset, vector<vector<Complex>> &pssset, int precision) {
+    uint64_t h = hashCombine(precision, pssset.size());
+    for(int pos = 0; pos < pssset.size(); pos++)
+        h = hashCombine(h, hashCapture(pssset[pos]));
+    int len = dataset.size() - pssset.size(); // г
+    return hashCombine(h, len);
+}
@@ -0,0 +1,131 @@
+#include "resultCache.h"
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <cstring>
+#include <cstdio>
+
+static const uint64_t PRIME_1 = 0x9E3779B185EBCA87ULL;
+static const uint64_t PRIME_2 = 0xC2B2AE3D27D4EB4FULL;
+static const char* CACHE_MAGIC = "resultCache-v1"; // ļʽ汾
+
+static inline uint64_t rotl(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+// ԹϣֵĻϣʹÿһλɢ
+static inline uint64_t finalMix(uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDULL;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+// һڴĹϣֵÿδ8ֽ
+uint64_t hashBytes(const void* data, size_t size, uint64_t seed) {
+    const unsigned char* p = (const unsigned char*)data;
+    uint64_t h = seed ^ (size * PRIME_1);
+    while (size >= 8) {
+        uint64_t word;
+        memcpy(&word, p, 8);
+        h = rotl(h ^ (word * PRIME_2), 31) * PRIME_1;
+        p += 8;
+        size -= 8;
+    }
+    if (size > 0) {
+        uint64_t word = 0;
+        memcpy(&word, p, size);
+        h = rotl(h ^ (word * PRIME_2), 31) * PRIME_1;
+    }
+    return finalMix(h);
+}
+
+// ϲϣֵ
+uint64_t hashCombine(uint64_t h, uint64_t v) {
+    return finalMix(rotl(h, 27) ^ (v * PRIME_2) ^ PRIME_1);
+}
+
+ResultCache::ResultCache(string filename, uint64_t configHash, int rootCnt) {
+    this->filename = filename;
+    this->configHash = configHash;
+    this->rootCnt = rootCnt;
+    this->hits = 0;
+    this->dirty = false;
+}
+
+// ȡļļڡʽԻ÷仯ʱȡκνPSSŲԵĿδ
+void ResultCache::load() {
+    entries.clear();
+    ifstream inFile;
+    inFile.open(filename, ios_base::in);
+    if (inFile.fail())
+        return;
+    string magic;
+    uint64_t fileConfigHash = 0;
+    inFile >> magic >> hex >> fileConfigHash >> dec;
+    if (inFile.fail() || magic != CACHE_MAGIC || fileConfigHash != configHash) {
+        dirty = true; // ɵĻѾϣʱ
+        return;
+    }
+    string line;
+    while (getline(inFile, line)) {
+        if (line.empty())
+            continue;
+        istringstream in(line);
+        uint64_t key;
+        int entryRootCnt;
+        CellResult result;
+        in >> hex >> key >> dec >> result.intensity >> result.bestRoot >> result.timing >> result.metric >> entryRootCnt;
+        if (in.fail() || entryRootCnt != rootCnt || result.bestRoot < 0 || result.bestRoot >= rootCnt)
+            continue;
+        result.rootMetric.resize(rootCnt);
+        for(int i = 0; i < rootCnt; i++)
+            in >> result.rootMetric[i];
+        if (!in.fail())
+            entries[key] = result;
+    }
+    inFile.close();
+}
+
+bool ResultCache::lookup(uint64_t key, CellResult &result) const {
+    auto iter = entries.find(key);
+    if (iter == entries.end())
+        return false;
+    result = iter->second;
+    result.cached = true;
+    result.valid = true;
+    hits++;
+    return true;
+}
+
+void ResultCache::store(uint64_t key, const CellResult &result) {
+    entries[key] = result;
+    entries[key].cached = false;
+    dirty = true;
+}
+
+// дʱļ滻жʱ²Ļ
+void ResultCache::save() const {
+    if (!dirty)
+        return;
+    string tempName = filename + ".tmp";
+    ofstream outFile;
+    outFile.open(tempName, ios_base::out | ios_base::trunc);
+    if (outFile.fail())
+        return;
+    outFile << CACHE_MAGIC << " " << hex << configHash << dec << endl;
+    outFile << setprecision(17); // ֤doubleغȫһ
+    for(auto iter = entries.begin(); iter != entries.end(); iter++) {
+        const CellResult &result = iter->second;
+        outFile << hex << iter->first << dec << " " << result.intensity << " " << result.bestRoot << " "
+                << result.timing << " " << result.metric << " " << result.rootMetric.size();
+        for(int i = 0; i < result.rootMetric.size(); i++)
+            outFile << " " << result.rootMetric[i];
+        outFile << endl;
+    }
+    outFile.close();
+    remove(filename.c_str());
+    rename(tempName.c_str(), filename.c_str());
+}
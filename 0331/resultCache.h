@@ -0,0 +1,45 @@
+#ifndef INC_0331_RESULTCACHE_H
+#define INC_0331_RESULTCACHE_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <stdint.h>
+
+using namespace std;
+
+/* ļļ */
+struct CellResult {
+    double intensity; // źǿ
+    int bestRoot; // ǿPSS
+    int timing; // طڵλ
+    double metric; // طֵ
+    vector<double> rootMetric; // ÿPSSֵ
+    bool cached; // Ƿӻж
+    bool valid; // ǷѾõԻ̼⣩
+    CellResult() : intensity(0), bestRoot(0), timing(0), metric(0), cached(false), valid(false) {};
+};
+
+uint64_t hashBytes(const void* data, size_t size, uint64_t seed); // һڴĹϣֵǼܣ
+uint64_t hashCombine(uint64_t h, uint64_t v); // ϲϣֵ
+
+/* 棬ݵĹϣֵΪãPSS仯ʱ */
+class ResultCache {
+public:
+    ResultCache(string filename, uint64_t configHash, int rootCnt); // 캯rootCntΪPSSĸ
+    ~ResultCache() {}; // 
+    void load(); // ȡļ
+    bool lookup(uint64_t key, CellResult &result) const; // һ
+    void store(uint64_t key, const CellResult &result); // д뻺
+    void save() const; // 滺ļ
+    int hitCount() const { return hits; }; // д
+private:
+    string filename; // ļ
+    uint64_t configHash; // õĹϣֵ
+    int rootCnt; // PSSĸÿrootMetricô
+    map<uint64_t, CellResult> entries; // 
+    mutable int hits; // д
+    bool dirty; // ǷµĽҪ
+};
+
+#endif //INC_0331_RESULTCACHE_H
@@ -0,0 +1,123 @@
+#include "shardSearch.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <cstdlib>
+#ifndef _WIN32
+#include <sched.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#endif
+
+// "0-15,32-47"CPUб
+static vector<int> parseCpuList(const string &text) {
+    vector<int> cpus;
+    stringstream in(text);
+    string range;
+    while (getline(in, range, ',')) {
+        if (range.empty())
+            continue;
+        int first = 0, last = 0;
+        size_t dash = range.find('-');
+        first = atoi(range.substr(0, dash).c_str());
+        last = (dash == string::npos) ? first : atoi(range.substr(dash + 1).c_str());
+        for(int cpu = first; cpu <= last; cpu++)
+            cpus.push_back(cpu);
+    }
+    return cpus;
+}
+
+// /sys/devices/system/nodeȡÿڵCPU
+vector<NumaNode> getNumaNodes() {
+    vector<NumaNode> nodes;
+    for(int id = 0; ; id++) {
+        ifstream inFile;
+        inFile.open("/sys/devices/system/node/node" + to_string(id) + "/cpulist", ios_base::in);
+        if (inFile.fail())
+            break;
+        string text;
+        getline(inFile, text);
+        NumaNode node;
+        node.id = id;
+        node.cpus = parseCpuList(text);
+        if (!node.cpus.empty())
+            nodes.push_back(node);
+        inFile.close();
+    }
+    if (nodes.empty()) {
+        NumaNode node;
+        node.id = 0;
+        nodes.push_back(node);
+    }
+    return nodes;
+}
+
+void pinToNode(const NumaNode &node) {
+#ifndef _WIN32
+    if (node.cpus.empty())
+        return;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for(int i = 0; i < node.cpus.size(); i++) {
+        if (node.cpus[i] < CPU_SETSIZE)
+            CPU_SET(node.cpus[i], &set);
+    }
+    sched_setaffinity(0, sizeof(set), &set);
+#endif
+}
+
+void* allocShared(size_t size) {
+#ifdef _WIN32
+    return malloc(size);
+#else
+    void* ptr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    return ptr == MAP_FAILED ? NULL : ptr;
+#endif
+}
+
+void freeShared(void* ptr, size_t size) {
+#ifdef _WIN32
+    free(ptr);
+#else
+    munmap(ptr, size);
+#endif
+}
+
+// WindowsûforkڱִÿƬ
+bool runWorkers(int workers, const function<void(int)> &work) {
+#ifdef _WIN32
+    for(int w = 0; w < workers; w++)
+        work(w);
+    return true;
+#else
+    cout.flush(); // ӽظе
+    fflush(stdout);
+    vector<pid_t> pids;
+    bool ok = true;
+    for(int w = 0; w < workers; w++) {
+        pid_t pid = fork();
+        if (pid == 0) {
+            int code = 0;
+            try {
+                work(w);
+            } catch (...) {
+                code = 1;
+            }
+            _exit(code);
+        } else if (pid < 0) {
+            cout << "" << w << "ӽʧܣ" << endl;
+            ok = false;
+            break;
+        }
+        pids.push_back(pid);
+    }
+    for(int i = 0; i < pids.size(); i++) {
+        int status = 0;
+        if (waitpid(pids[i], &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+            ok = false;
+    }
+    return ok;
+#endif
+}
@@ -0,0 +1,142 @@
+#ifndef INC_0331_SHARDSEARCH_H
+#define INC_0331_SHARDSEARCH_H
+
+#include <vector>
+#include <functional>
+#include <math.h>
+#include "correlation.h"
+#include "resultCache.h"
+
+using namespace std;
+
+/* NUMAڵ */
+struct NumaNode {
+    int id; // ڵ
+    vector<int> cpus; // ڵϵCPUţΪձʾ
+};
+
+vector<NumaNode> getNumaNodes(); // ȡNUMAˣûNUMAϢʱһCPUĽڵ
+void pinToNode(const NumaNode &node); // ѵǰ̰󶨵ڵCPU
+void* allocShared(size_t size); // ̼乲ڴ
+void freeShared(void* ptr, size_t size); // ͷŹڴ
+bool runWorkers(int workers, const function<void(int)> &work); // workersӽִworkȫɹtrue
+
+/* һƬһļһλλãÿļĵһƬļǿ */
+struct ShardTask {
+    int capture; // ļ
+    int lagBegin, lagEnd; // λ÷Χ[lagBegin, lagEnd)
+    bool withIntensity; // Ƿǿ
+};
+
+/* ƬһPSSľֲط */
+struct ShardPeak {
+    double peak; // ֵ
+    int lag; // ֵڵλ
+};
+
+/*
+ * ̷Ƭ⣺δлļļƬļڽʱٰѻλгɼΡ
+ * w̰󶨵w % ڵNUMAڵ㣬󶨺ŸPSSݣʹڱڵڴϡ
+ * ÿƬĽд빲ڴԼĲλȫ̽󰴷Ƭ˳鲢޹ء
+ * ǿȲз֣㲿ֺ͵Ľзַʽйأ뵥ͬ˳ļ͡
+ * nodesΪgetNumaNodes()ĽӽʧʱfalseӦΪ̼⡣
+ */
+template<typename Real>
+bool shardedSearch(vector<Samples<Real>> &dataSamples, vector<Samples<Real>> &pssSamples, int lagCnt,
+                   vector<CellResult> &results, int workers, const vector<NumaNode> &nodes) {
+    int captureCnt = dataSamples.size();
+    int rootCnt = pssSamples.size();
+    vector<int> pending; // Ҫļ
+    for(int cnt = 0; cnt < captureCnt; cnt++) {
+        if (!results[cnt].valid)
+            pending.push_back(cnt);
+    }
+    if (pending.empty())
+        return true;
+    if (lagCnt <= 0 || rootCnt == 0)
+        return false;
+
+    // 
+    int splits = (workers + pending.size() - 1) / pending.size();
+    splits = max(1, min(splits, lagCnt));
+    vector<ShardTask> tasks;
+    for(int i = 0; i < pending.size(); i++) {
+        for(int s = 0; s < splits; s++) {
+            ShardTask task;
+            task.capture = pending[i];
+            task.lagBegin = (long long)lagCnt * s / splits;
+            task.lagEnd = (long long)lagCnt * (s + 1) / splits;
+            task.withIntensity = s == 0;
+            tasks.push_back(task);
+        }
+    }
+    int taskCnt = tasks.size();
+
+    // ڴ棺ÿÿPSSһط壬ÿһǿȣֻеһƬЧ
+    size_t peakBytes = sizeof(ShardPeak) * taskCnt * rootCnt;
+    size_t sharedBytes = peakBytes + sizeof(double) * taskCnt;
+    void* shared = allocShared(sharedBytes);
+    if (shared == NULL)
+        return false;
+    ShardPeak* peaks = (ShardPeak*)shared;
+    double* intensity = (double*)((char*)shared + peakBytes);
+
+    int pssLen = 0; // PSSҪһλϵȫ
+    for(int pos = 0; pos < rootCnt; pos++)
+        pssLen = max(pssLen, pssSamples[pos].size());
+    bool ok = runWorkers(workers, [&](int w) {
+        pinToNode(nodes[w % nodes.size()]);
+        // ڱڵ·仺
+        vector<Samples<Real>> localPss = pssSamples;
+        for(int t = w; t < taskCnt; t += workers) {
+            ShardTask &task = tasks[t];
+            Samples<Real> &data = dataSamples[task.capture];
+            intensity[t] = task.withIntensity ? CorrelationKernel<Real>::modulusSum(data) : 0;
+            Samples<Real> window = slice(data, task.lagBegin, min(data.size(), task.lagEnd - 1 + pssLen));
+            for(int pos = 0; pos < rootCnt; pos++) {
+                ShardPeak best;
+                best.peak = -HUGE_VAL;
+                best.lag = task.lagBegin;
+                for(int k = task.lagBegin; k < task.lagEnd; k++) {
+                    double value = CorrelationKernel<Real>::dot(localPss[pos], window, k - task.lagBegin);
+                    if (value > best.peak) {
+                        best.peak = value;
+                        best.lag = k;
+                    }
+                }
+                peaks[t * rootCnt + pos] = best;
+            }
+        }
+    });
+
+    // 鲢ļλ˳Уȡһֵ뵥̽һ
+    if (ok) {
+        for(int t = 0; t < taskCnt; t += splits) {
+            CellResult &cell = results[tasks[t].capture];
+            cell.intensity = intensity[t];
+            cell.rootMetric.assign(rootCnt, 0);
+            vector<int> rootLag(rootCnt, 0);
+            for(int s = 0; s < splits; s++) {
+                for(int pos = 0; pos < rootCnt; pos++) {
+                    ShardPeak &part = peaks[(t + s) * rootCnt + pos];
+                    if (s == 0 || part.peak > cell.rootMetric[pos]) {
+                        cell.rootMetric[pos] = part.peak;
+                        rootLag[pos] = part.lag;
+                    }
+                }
+            }
+            for(int pos = 0; pos < rootCnt; pos++) {
+                if (pos == 0 || cell.rootMetric[pos] > cell.metric) {
+                    cell.bestRoot = pos;
+                    cell.timing = rootLag[pos];
+                    cell.metric = cell.rootMetric[pos];
+                }
+            }
+            cell.valid = true;
+        }
+    }
+    freeShared(shared, sharedBytes);
+    return ok;
+}
+
+#endif //INC_0331_SHARDSEARCH_H
@@ -0,0 +1,42 @@
+#ifndef INC_0414_BMP_H
+#define INC_0414_BMP_H
+
+// 0508Bmp.hͬLONGΪint֤64λLinuxҲ32λ
+typedef unsigned char BYTE;
+typedef unsigned short WORD;
+typedef unsigned int DWORD;
+typedef int LONG;
+
+// λͼļͷ
+typedef struct tagBITMAPFILEHEADER{
+    //WORD bfType;//ļͣ0x424DַBM
+    DWORD bfSize;//ļС
+    WORD bfReserved1;//
+    WORD bfReserved2;//
+    DWORD bfOffBits;//ļͷʵλͼݵƫֽ
+}BITMAPFILEHEADER;
+
+// λͼϢͷ
+typedef struct tagBITMAPINFOHEADER{
+    DWORD biSize;//ϢͷС
+    LONG biWidth;//ͼ
+    LONG biHeight;//ͼ߶
+    WORD biPlanes;//λƽΪ1
+    WORD biBitCount;//ÿλ
+    DWORD  biCompression; //ѹ
+    DWORD  biSizeImage; //ѹͼСֽ
+    LONG  biXPelsPerMeter; //ˮƽֱ
+    LONG  biYPelsPerMeter; //ֱֱ
+    DWORD  biClrUsed; //λͼʵõɫ
+    DWORD  biClrImportant; //λͼҪɫ
+}BITMAPINFOHEADER;
+
+//Ϣ
+typedef struct tagIMAGEDATA
+{
+    BYTE blue;
+    BYTE green;
+    BYTE red;
+}IMAGEDATA;
+
+#endif //INC_0414_BMP_H
@@ -0,0 +1,173 @@
+#include "forceLayout.h"
+#include "quadTree.h"
+#include "threadPool.h"
+#include <math.h>
+#include <random>
+#include <algorithm>
+
+// Լ k^2 / dO(n^2)
+static void exactRepulsion(const vector<Point2D> &pos, double k2, vector<Point2D> &disp) {
+    int n = pos.size();
+    for(int i = 0; i < n; i++) {
+        for(int j = i + 1; j < n; j++) {
+            double dx = pos[i].x - pos[j].x;
+            double dy = pos[i].y - pos[j].y;
+            double dist2 = max(dx * dx + dy * dy, 1e-4);
+            double factor = k2 / dist2;
+            disp[i].x += dx * factor;
+            disp[i].y += dy * factor;
+            disp[j].x -= dx * factor;
+            disp[j].y -= dy * factor;
+        }
+    }
+}
+
+// ĲƼO(n log n)
+static void barnesHutRepulsion(const vector<Point2D> &pos, double k2, double theta, QuadTree &tree,
+                               vector<Point2D> &disp) {
+    tree.build(pos);
+    for(int i = 0; i < pos.size(); i++)
+        tree.repulsion(pos, i, k2, theta, disp[i].x, disp[i].y);
+}
+
+// ر߼ d^2 / kO(m)
+static void attraction(const vector<Point2D> &pos, const int* s, const int* t, int edgeCnt, double k,
+                       vector<Point2D> &disp) {
+    for(int e = 0; e < edgeCnt; e++) {
+        int u = s[e] - 1;
+        int v = t[e] - 1;
+        if (u == v)
+            continue;
+        double dx = pos[u].x - pos[v].x;
+        double dy = pos[u].y - pos[v].y;
+        double dist = max(sqrt(dx * dx + dy * dy), 1e-2);
+        double factor = dist / k;
+        disp[u].x -= dx * factor;
+        disp[u].y -= dy * factor;
+        disp[v].x += dx * factor;
+        disp[v].y += dy * factor;
+    }
+}
+
+// ¶λƺƶ
+static void moveVertices(vector<Point2D> &pos, const vector<Point2D> &disp, double temperature) {
+    for(int i = 0; i < pos.size(); i++) {
+        double len = sqrt(disp[i].x * disp[i].x + disp[i].y * disp[i].y);
+        if (len > 0) {
+            double step = min(len, temperature);
+            pos[i].x += disp[i].x / len * step;
+            pos[i].y += disp[i].y / len * step;
+        }
+    }
+}
+
+/*
+ * ִ߳һε㰴̷ֿ߳飬߳ͬһĲϼԼǿ鶥ĳ
+ * ̷ֿ߰߳飬̰߳ۼӵԼĻ㰴߳˳鲢ƶ
+ * ÿļ˳ֻ߳йأԽȷġ
+ */
+static void parallelIteration(ThreadPool &pool, vector<Point2D> &pos, const int* s, const int* t, int edgeCnt,
+                              double k, double theta, double temperature, QuadTree &tree,
+                              vector<vector<Point2D>> &buffers, vector<Point2D> &disp) {
+    int n = pos.size();
+    int parts = buffers.size();
+    double k2 = k * k;
+    if (theta > 0)
+        tree.build(pos);
+    pool.parallelFor(parts, [&](int part) {
+        int begin = (long long)n * part / parts;
+        int end = (long long)n * (part + 1) / parts;
+        for(int i = begin; i < end; i++) {
+            disp[i].x = 0;
+            disp[i].y = 0;
+            if (theta > 0) {
+                tree.repulsion(pos, i, k2, theta, disp[i].x, disp[i].y);
+            } else {
+                for(int j = 0; j < n; j++) {
+                    if (j == i)
+                        continue;
+                    double dx = pos[i].x - pos[j].x;
+                    double dy = pos[i].y - pos[j].y;
+                    double factor = k2 / max(dx * dx + dy * dy, 1e-4);
+                    disp[i].x += dx * factor;
+                    disp[i].y += dy * factor;
+                }
+            }
+        }
+        vector<Point2D> &buffer = buffers[part];
+        for(int i = 0; i < n; i++) {
+            buffer[i].x = 0;
+            buffer[i].y = 0;
+        }
+        int edgeBegin = (long long)edgeCnt * part / parts;
+        int edgeEnd = (long long)edgeCnt * (part + 1) / parts;
+        attraction(pos, s + edgeBegin, t + edgeBegin, edgeEnd - edgeBegin, k, buffer);
+    });
+    pool.parallelFor(parts, [&](int part) {
+        int begin = (long long)n * part / parts;
+        int end = (long long)n * (part + 1) / parts;
+        for(int i = begin; i < end; i++) {
+            for(int j = 0; j < parts; j++) {
+                disp[i].x += buffers[j][i].x;
+                disp[i].y += buffers[j][i].y;
+            }
+            double len = sqrt(disp[i].x * disp[i].x + disp[i].y * disp[i].y);
+            if (len > 0) {
+                double step = min(len, temperature);
+                pos[i].x += disp[i].x / len * step;
+                pos[i].y += disp[i].y / len * step;
+            }
+        }
+    });
+}
+
+vector<Point2D> forceLayout(const int* s, const int* t, int edgeCnt, int vertexCnt, const LayoutParams &params) {
+    vector<Point2D> pos(vertexCnt);
+    if (vertexCnt == 0)
+        return pos;
+
+    // ʼ
+    mt19937 random(params.seed);
+    uniform_real_distribution<double> randomX(0, params.width);
+    uniform_real_distribution<double> randomY(0, params.height);
+    for(int i = 0; i < vertexCnt; i++) {
+        pos[i].x = randomX(random);
+        pos[i].y = randomY(random);
+    }
+    refineLayout(s, t, edgeCnt, pos, params, params.iterations, params.width / 10);
+    return pos;
+}
+
+void refineLayout(const int* s, const int* t, int edgeCnt, vector<Point2D> &pos,
+                  const LayoutParams &params, int iterations, double temperature) {
+    int vertexCnt = pos.size();
+    if (vertexCnt == 0)
+        return;
+    double k = sqrt(params.width * params.height / vertexCnt); // ߳
+    double cooling = temperature / (iterations + 1);
+    vector<Point2D> disp(vertexCnt);
+    QuadTree tree;
+
+    if (params.threads > 1) {
+        ThreadPool pool(params.threads);
+        vector<vector<Point2D>> buffers(params.threads, vector<Point2D>(vertexCnt)); // ÿ̵߳
+        for(int iter = 0; iter < iterations; iter++) {
+            parallelIteration(pool, pos, s, t, edgeCnt, k, params.theta, temperature, tree, buffers, disp);
+            temperature -= cooling;
+        }
+        return;
+    }
+    for(int iter = 0; iter < iterations; iter++) {
+        for(int i = 0; i < vertexCnt; i++) {
+            disp[i].x = 0;
+            disp[i].y = 0;
+        }
+        if (params.theta > 0)
+            barnesHutRepulsion(pos, k * k, params.theta, tree, disp);
+        else
+            exactRepulsion(pos, k * k, disp);
+        attraction(pos, s, t, edgeCnt, k, disp);
+        moveVertices(pos, disp, temperature);
+        temperature -= cooling;
+    }
+}
@@ -0,0 +1,39 @@
+#ifndef INC_0414_FORCELAYOUT_H
+#define INC_0414_FORCELAYOUT_H
+
+#include <vector>
+
+using namespace std;
+
+/* ƽϵĵ */
+struct Point2D {
+    double x;
+    double y;
+};
+
+/* 򲼾ֵĲ */
+struct LayoutParams {
+    int iterations; // 
+    double width; // 
+    double height; // ߶
+    unsigned int seed; // ʼ
+    double theta; // Barnes-HutƵŽֵԽԽ졢Խȷ0ʾԾȷ
+    int threads; // ߳ͬӺ߳õĽͬ
+    LayoutParams() : iterations(300), width(800), height(600), seed(1), theta(0.8), threads(1) {};
+};
+
+/*
+ * Fruchterman-Reingold򲼾֡Barnes-HutĲƣÿεO(n log n)ֻڱϼ㣬O(m)
+ * stdrawGraphĲͬiӶs[i]t[i]1ʼţȨ޹أҪw
+ * ÿ꣬±0ʼ
+ */
+vector<Point2D> forceLayout(const int* s, const int* t, int edgeCnt, int vertexCnt, const LayoutParams &params);
+
+/*
+ * posе꿪ʼiterationsΣtemperatureΪһελƣ֮Խ0
+ * ߳Ͷ㣬forceLayoutͬ
+ */
+void refineLayout(const int* s, const int* t, int edgeCnt, vector<Point2D> &pos,
+                  const LayoutParams &params, int iterations, double temperature);
+
+#endif //INC_0414_FORCELAYOUT_H
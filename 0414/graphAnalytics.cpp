@@ -0,0 +1,133 @@
+#include "graphAnalytics.h"
+#include "threadPool.h"
+#include <atomic>
+#include <memory>
+#include <algorithm>
+
+/* 鼯 */
+class ConcurrentUnionFind {
+public:
+    ConcurrentUnionFind(int n) : parent(new atomic<int>[n]) {
+        for(int i = 0; i < n; i++)
+            parent[i].store(i, memory_order_relaxed);
+    };
+    int find(int x); // Ҹ˳·
+    void unite(int a, int b); // ϲabڵļ
+private:
+    unique_ptr<atomic<int>[]> parent;
+};
+
+int ConcurrentUnionFind::find(int x) {
+    while (true) {
+        int p = parent[x].load(memory_order_relaxed);
+        if (p == x)
+            return x;
+        int grand = parent[p].load(memory_order_relaxed);
+        if (grand == p)
+            return p;
+        // ʧ˵߳ѾĹָͬĶ㣬
+        parent[x].compare_exchange_weak(p, grand, memory_order_relaxed);
+        x = grand;
+    }
+}
+
+void ConcurrentUnionFind::unite(int a, int b) {
+    while (true) {
+        a = find(a);
+        b = find(b);
+        if (a == b)
+            return;
+        if (a < b)
+            swap(a, b);
+        // ֻaȻǸʱܹȥ²
+        int expected = a;
+        if (parent[a].compare_exchange_strong(expected, b, memory_order_acq_rel))
+            return;
+    }
+}
+
+GraphStats analyzeGraph(const SparseGraph &graph, int threads) {
+    int n = graph.vertexCount();
+    int m = graph.edgeCount();
+    const int* s = graph.sources();
+    const int* t = graph.targets();
+    ThreadPool pool(threads);
+    int parts = pool.size();
+    GraphStats stats;
+
+    // кϲÿߵ˵
+    ConcurrentUnionFind sets(n);
+    pool.parallelFor(parts, [&](int part) {
+        int begin = (long long)m * part / parts;
+        int end = (long long)m * (part + 1) / parts;
+        for(int e = begin; e < end; e++)
+            sets.unite(s[e] - 1, t[e] - 1);
+    });
+
+    // ÿĸͬʱͳƶֲ
+    stats.component.resize(n);
+    vector<vector<int>> histograms(parts);
+    pool.parallelFor(parts, [&](int part) {
+        int begin = (long long)n * part / parts;
+        int end = (long long)n * (part + 1) / parts;
+        vector<int> &histogram = histograms[part];
+        for(int v = begin; v < end; v++) {
+            stats.component[v] = sets.find(v);
+            int d = graph.degree(v + 1);
+            if (d >= histogram.size())
+                histogram.resize(d + 1, 0);
+            histogram[d]++;
+        }
+    });
+    stats.degreeHistogram.clear();
+    for(int part = 0; part < parts; part++) {
+        if (histograms[part].size() > stats.degreeHistogram.size())
+            stats.degreeHistogram.resize(histograms[part].size(), 0);
+        for(int d = 0; d < histograms[part].size(); d++)
+            stats.degreeHistogram[d] += histograms[part][d];
+    }
+    stats.maxDegree = max((int)stats.degreeHistogram.size() - 1, 0);
+
+    // ͳƷССͬʱȡС
+    vector<int> size(n, 0);
+    for(int v = 0; v < n; v++)
+        size[stats.component[v]]++;
+    stats.componentCnt = 0;
+    stats.largestRoot = -1;
+    stats.largestSize = 0;
+    for(int v = 0; v < n; v++) {
+        if (stats.component[v] != v)
+            continue;
+        stats.componentCnt++;
+        if (size[v] > stats.largestSize) {
+            stats.largestSize = size[v];
+            stats.largestRoot = v;
+        }
+    }
+    return stats;
+}
+
+SparseGraph largestComponent(const SparseGraph &graph, const GraphStats &stats, vector<int>* original) {
+    int n = graph.vertexCount();
+    vector<int> index(n, 0); // ԭͼеıţ1ʼ0ʾ
+    int cnt = 0;
+    if (original != NULL)
+        original->clear();
+    for(int v = 0; v < n; v++) {
+        if (stats.component[v] == stats.largestRoot) {
+            index[v] = ++cnt;
+            if (original != NULL)
+                original->push_back(v);
+        }
+    }
+    SparseGraph result(cnt);
+    const int* s = graph.sources();
+    const int* t = graph.targets();
+    const int* w = graph.weights();
+    for(int e = 0; e < graph.edgeCount(); e++) {
+        if (index[s[e] - 1] > 0)
+            result.addEdge(index[s[e] - 1], index[t[e] - 1], w[e]);
+    }
+    result.freeze();
+    return result;
+}
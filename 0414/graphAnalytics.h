@@ -0,0 +1,33 @@
+#ifndef INC_0414_GRAPHANALYTICS_H
+#define INC_0414_GRAPHANALYTICS_H
+
+#include <vector>
+#include <cstddef>
+#include "sparseGraph.h"
+
+using namespace std;
+
+/* ͼĽṹͳ */
+struct GraphStats {
+    vector<int> component; // ÿ㣨0ʼͨĴ
+    int componentCnt; // ͨ
+    int largestRoot; // ͨĴ
+    int largestSize; // ͨĶ
+    vector<int> degreeHistogram; // degreeHistogram[d]ΪΪdĶ
+    int maxDegree; // 
+};
+
+/*
+ * threads߳ͳͨͶֲgraphѾfreeze
+ * ͨ鼯parentΪԭ飬ϲʱCASѱŴĸҵСĸ£ʱ˳CAS·룬
+ * ̷ֿ߳鴦߱ǷбСĶ㣬Խ߳޹ء
+ * ֲɸ߳ͳԼǿ鶥ٺϲ
+ */
+GraphStats analyzeGraph(const SparseGraph &graph, int threads = 1);
+
+/*
+ * ȡͨ㰴ԭ˳´1šoriginalΪNULLʱ¶㣨0ʼӦԭ㣨0ʼ
+ */
+SparseGraph largestComponent(const SparseGraph &graph, const GraphStats &stats, vector<int>* original = NULL);
+
+#endif //INC_0414_GRAPHANALYTICS_H
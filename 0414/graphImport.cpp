@@ -0,0 +1,295 @@
+#include "graphImport.h"
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include <cstring>
+#include <cctype>
+#include <stdint.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+/* ֻӳ䵽ڴеļ */
+class MappedFile {
+public:
+    MappedFile() : data(NULL), size(0) {};
+    ~MappedFile() { close(); };
+    bool open(string filename);
+    void close();
+    const char* data; // ļ
+    size_t size; // ļС
+#ifdef _WIN32
+private:
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE mapping = NULL;
+#endif
+};
+
+#ifdef _WIN32
+bool MappedFile::open(string filename) {
+    file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                       FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+    LARGE_INTEGER fileSize;
+    GetFileSizeEx(file, &fileSize);
+    size = fileSize.QuadPart;
+    if (size == 0)
+        return true;
+    mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping == NULL)
+        return false;
+    data = (const char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    return data != NULL;
+}
+
+void MappedFile::close() {
+    if (data != NULL)
+        UnmapViewOfFile(data);
+    if (mapping != NULL)
+        CloseHandle(mapping);
+    if (file != INVALID_HANDLE_VALUE)
+        CloseHandle(file);
+    data = NULL;
+    mapping = NULL;
+    file = INVALID_HANDLE_VALUE;
+}
+#else
+bool MappedFile::open(string filename) {
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+    struct stat info;
+    if (fstat(fd, &info) < 0) {
+        ::close(fd);
+        return false;
+    }
+    size = info.st_size;
+    if (size > 0) {
+        void* ptr = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (ptr == MAP_FAILED) {
+            ::close(fd);
+            return false;
+        }
+        madvise(ptr, size, MADV_SEQUENTIAL);
+        data = (const char*)ptr;
+    }
+    ::close(fd);
+    return true;
+}
+
+void MappedFile::close() {
+    if (data != NULL)
+        munmap((void*)data, size);
+    data = NULL;
+    size = 0;
+}
+#endif
+
+/* һļĽ */
+struct ParsedChunk {
+    vector<int> s, t, w; // ߱
+    int maxVertex; // ֹ󶥵
+    int declaredVertexCnt; // DIMACSĶ
+    int skippedCnt; // ޷ŻȨֵϷ
+    ParsedChunk() : maxVertex(0), declaredVertexCnt(0), skippedCnt(0) {};
+};
+
+static inline bool isBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+// հ׺ͷָCSVĶţ
+static inline const char* skipSeparators(const char* p, const char* end, bool csv) {
+    while (p < end && (isBlank(*p) || (csv && *p == ',')))
+        p++;
+    return p;
+}
+
+// һСֱӽصûʱfalseֵ2^40ʱͣһintΧֵϣ
+static inline bool parseInt(const char* &p, const char* end, long long &value) {
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = *p == '-';
+        p++;
+    }
+    if (p >= end || *p < '0' || *p > '9')
+        return false;
+    long long result = 0;
+    while (p < end && *p >= '0' && *p <= '9') {
+        if (result < ((long long)1 << 40))
+            result = result * 10 + (*p - '0');
+        p++;
+    }
+    if (p < end && *p == '.') {
+        p++;
+        while (p < end && *p >= '0' && *p <= '9')
+            p++;
+    }
+    value = negative ? -result : result;
+    return true;
+}
+
+// [begin, end)еУbegin
+static void parseChunk(const char* begin, const char* end, GraphFormat format, ParsedChunk &out) {
+    bool csv = format == FORMAT_CSV;
+    const char* p = begin;
+    while (p < end) {
+        const char* lineEnd = (const char*)memchr(p, '\n', end - p);
+        if (lineEnd == NULL)
+            lineEnd = end;
+        const char* q = skipSeparators(p, lineEnd, false);
+        if (q < lineEnd) {
+            char first = *q;
+            if (format == FORMAT_DIMACS) {
+                if (first == 'p') {
+                    // p sp n m
+                    q++;
+                    while (q < lineEnd && !isBlank(*q))
+                        q++;
+                    while (q < lineEnd && isBlank(*q))
+                        q++;
+                    while (q < lineEnd && !isBlank(*q) && (*q < '0' || *q > '9'))
+                        q++;
+                    long long n;
+                    q = skipSeparators(q, lineEnd, false);
+                    if (parseInt(q, lineEnd, n))
+                        out.declaredVertexCnt = max<long long>(out.declaredVertexCnt, n);
+                    first = 0;
+                } else if (first == 'a' || first == 'e') {
+                    q++;
+                } else {
+                    first = 0;
+                }
+            } else if (first == '#' || first == '%') {
+                first = 0;
+            }
+            long long u, v, weight = 1;
+            if (first != 0) {
+                q = skipSeparators(q, lineEnd, csv);
+                if (parseInt(q, lineEnd, u)) {
+                    q = skipSeparators(q, lineEnd, csv);
+                    if (parseInt(q, lineEnd, v)) {
+                        q = skipSeparators(q, lineEnd, csv);
+                        parseInt(q, lineEnd, weight);
+                        // ȨֵΪ뽻SparseGraph::addEdgeһ£intΧȨֵܽضϣϷ
+                        if (u > 0 && v > 0 && u <= INT32_MAX && v <= INT32_MAX &&
+                            weight > 0 && weight <= INT32_MAX) {
+                            out.s.push_back(min(u, v));
+                            out.t.push_back(max(u, v));
+                            out.w.push_back(weight);
+                            out.maxVertex = max<long long>(out.maxVertex, max(u, v));
+                            first = 0;
+                        }
+                    }
+                }
+                // ʧܻ򲻺ϷУCSVͷ
+                if (first != 0)
+                    out.skippedCnt++;
+            }
+        }
+        p = lineEnd + 1;
+    }
+}
+
+// չ͵һЧжϸʽ
+static GraphFormat detectFormat(string filename, const char* data, size_t size) {
+    string ext = filename.substr(filename.find_last_of('.') + 1);
+    transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+    if (ext == "csv")
+        return FORMAT_CSV;
+    if (ext == "gr" || ext == "dimacs" || ext == "col")
+        return FORMAT_DIMACS;
+    const char* p = data;
+    const char* end = data + size;
+    while (p < end) {
+        const char* lineEnd = (const char*)memchr(p, '\n', end - p);
+        if (lineEnd == NULL)
+            lineEnd = end;
+        const char* q = skipSeparators(p, lineEnd, false);
+        if (q < lineEnd && *q != '#' && *q != '%') {
+            if (*q == 'c' || *q == 'p' || *q == 'a' || *q == 'e')
+                return FORMAT_DIMACS;
+            if (memchr(q, ',', lineEnd - q) != NULL)
+                return FORMAT_CSV;
+            return FORMAT_EDGELIST;
+        }
+        p = lineEnd + 1;
+    }
+    return FORMAT_EDGELIST;
+}
+
+// һı߱Ƶϲ߱[from, from + chunk.s.size())λãȻͷһ
+static void copyChunk(ParsedChunk &chunk, size_t from, vector<int> &s, vector<int> &t, vector<int> &w) {
+    copy(chunk.s.begin(), chunk.s.end(), s.begin() + from);
+    copy(chunk.t.begin(), chunk.t.end(), t.begin() + from);
+    copy(chunk.w.begin(), chunk.w.end(), w.begin() + from);
+    vector<int>().swap(chunk.s);
+    vector<int>().swap(chunk.t);
+    vector<int>().swap(chunk.w);
+}
+
+bool importGraph(string filename, SparseGraph &graph, GraphFormat format, int threads, int* skippedCnt) {
+    MappedFile file;
+    if (!file.open(filename))
+        return false;
+    if (format == FORMAT_AUTO)
+        format = detectFormat(filename, file.data, file.size);
+
+    // п飬ÿ㶼
+    threads = max(1, threads);
+    if (file.size < (1 << 20))
+        threads = 1;
+    vector<const char*> bounds(threads + 1);
+    const char* end = file.data + file.size;
+    bounds[0] = file.data;
+    bounds[threads] = end;
+    for(int i = 1; i < threads; i++) {
+        const char* p = file.data + file.size / threads * i;
+        p = max(p, bounds[i - 1]);
+        const char* lineEnd = (const char*)memchr(p, '\n', end - p);
+        bounds[i] = lineEnd == NULL ? end : lineEnd + 1;
+    }
+
+    vector<ParsedChunk> chunks(threads);
+    if (threads == 1) {
+        parseChunk(bounds[0], bounds[1], format, chunks[0]);
+    } else {
+        vector<thread> workers;
+        for(int i = 0; i < threads; i++)
+            workers.push_back(thread(parseChunk, bounds[i], bounds[i + 1], format, ref(chunks[i])));
+        for(int i = 0; i < threads; i++)
+            workers[i].join();
+    }
+
+    // ˳ϲÿڱ߱е㣬ٲи
+    int vertexCnt = 0;
+    int skipped = 0;
+    vector<size_t> from(threads + 1, 0);
+    for(int i = 0; i < threads; i++) {
+        vertexCnt = max(vertexCnt, max(chunks[i].maxVertex, chunks[i].declaredVertexCnt));
+        skipped += chunks[i].skippedCnt;
+        from[i + 1] = from[i] + chunks[i].s.size();
+    }
+    if (skippedCnt != NULL)
+        *skippedCnt = skipped;
+    vector<int> s(from[threads]), t(from[threads]), w(from[threads]);
+    if (threads == 1) {
+        copyChunk(chunks[0], 0, s, t, w);
+    } else {
+        vector<thread> workers;
+        for(int i = 0; i < threads; i++)
+            workers.push_back(thread(copyChunk, ref(chunks[i]), from[i], ref(s), ref(t), ref(w)));
+        for(int i = 0; i < threads; i++)
+            workers[i].join();
+    }
+    graph = SparseGraph(vertexCnt);
+    graph.assignEdges(s, t, w);
+    graph.freeze();
+    return true;
+}
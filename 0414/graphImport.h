@@ -0,0 +1,26 @@
+#ifndef INC_0414_GRAPHIMPORT_H
+#define INC_0414_GRAPHIMPORT_H
+
+#include <string>
+#include "sparseGraph.h"
+
+using namespace std;
+
+/* ߱ļĸʽ */
+enum GraphFormat {
+    FORMAT_AUTO, // չļж
+    FORMAT_EDGELIST, // ÿ"u v [w]"#%ͷΪע
+    FORMAT_DIMACS, // "p sp n m"ģ"a u v w""e u v"ΪߣcͷΪע
+    FORMAT_CSV // ÿ"u,v[,w]"бͷ
+};
+
+/*
+ * ѱ߱ļӳ䵽ڴֱӽgraphѾfreeze
+ * threads1ʱļгthreads鲢нٰ˳ϲ߳޹ء
+ * 1ʼţûȨֵıȨֵΪ1ȡDIMACSĹģͳֹнϴһ
+ * ޷СŲ[1, INT32_MAX]ڵСȨֵ[1, INT32_MAX]ڵжskippedCntΪNULLʱ
+ */
+bool importGraph(string filename, SparseGraph &graph, GraphFormat format = FORMAT_AUTO, int threads = 1,
+                 int* skippedCnt = NULL);
+
+#endif //INC_0414_GRAPHIMPORT_H
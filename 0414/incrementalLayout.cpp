@@ -0,0 +1,220 @@
+#include "incrementalLayout.h"
+#include "quadTree.h"
+#include <fstream>
+#include <sstream>
+#include <unordered_map>
+#include <random>
+#include <math.h>
+#include <algorithm>
+#include <cctype>
+
+bool loadLayout(string filename, vector<Point2D> &pos) {
+    ifstream in(filename);
+    if (!in.is_open())
+        return false;
+    pos.clear();
+    Point2D p;
+    while (in >> p.x >> p.y)
+        pos.push_back(p);
+    return in.eof();
+}
+
+bool saveLayout(string filename, const vector<Point2D> &pos) {
+    ofstream out(filename);
+    if (!out.is_open())
+        return false;
+    out.precision(17);
+    for(int i = 0; i < pos.size(); i++)
+        out << pos[i].x << " " << pos[i].y << "\n";
+    return out.good();
+}
+
+bool loadDelta(string filename, vector<EdgeDelta> &delta) {
+    ifstream in(filename);
+    if (!in.is_open())
+        return false;
+    delta.clear();
+    string line;
+    while (getline(in, line)) {
+        istringstream fields(line);
+        string op;
+        if (!(fields >> op) || op[0] == '#')
+            continue;
+        EdgeDelta d;
+        d.add = op == "+";
+        d.weight = 1;
+        if ((op != "+" && op != "-") || !(fields >> d.u >> d.v) || d.u <= 0 || d.v <= 0)
+            return false;
+        if (d.add) {
+            // Ȩֵʡԣд˾ͱʱ0applyDelta0ʾɾ
+            fields >> ws;
+            if (!fields.eof() && (!(fields >> d.weight) || d.weight <= 0 ||
+                                  (fields.peek() != EOF && !isspace(fields.peek()))))
+                return false;
+        }
+        delta.push_back(d);
+    }
+    return true;
+}
+
+// ߵļСĶ˵ڸλ
+static long long edgeKey(int u, int v) {
+    if (u > v)
+        swap(u, v);
+    return (long long)u << 32 | v;
+}
+
+SparseGraph applyDelta(const SparseGraph &graph, const vector<EdgeDelta> &delta) {
+    // ˳úÿᵽıߵ״̬Ȩֵ0ʾɾ
+    unordered_map<long long, int> last;
+    int n = graph.vertexCount();
+    for(int i = 0; i < delta.size(); i++) {
+        last[edgeKey(delta[i].u, delta[i].v)] = delta[i].add ? delta[i].weight : 0;
+        if (delta[i].add)
+            n = max(n, max(delta[i].u, delta[i].v));
+    }
+
+    SparseGraph result(n);
+    result.reserve(graph.edgeCount() + delta.size());
+    const int* s = graph.sources();
+    const int* t = graph.targets();
+    const int* w = graph.weights();
+    for(int e = 0; e < graph.edgeCount(); e++) {
+        if (last.find(edgeKey(s[e], t[e])) == last.end())
+            result.addEdge(s[e], t[e], w[e]);
+    }
+    for(unordered_map<long long, int>::iterator it = last.begin(); it != last.end(); ++it) {
+        if (it->second != 0)
+            result.addEdge(it->first >> 32, it->first & 0xffffffff, it->second);
+    }
+    result.freeze();
+    return result;
+}
+
+// deltaĶ˵hopsӰĶ㣨0ʼaffected[v]ǷӰ
+static vector<int> affectedVertices(const SparseGraph &graph, const vector<Point2D> &previous,
+                                    const vector<EdgeDelta> &delta, int hops, vector<char> &affected) {
+    int n = graph.vertexCount();
+    affected.assign(n, 0);
+    vector<int> result;
+    for(int i = 0; i < delta.size(); i++) {
+        int ends[2] = {delta[i].u - 1, delta[i].v - 1};
+        for(int j = 0; j < 2; j++) {
+            if (ends[j] < n && !affected[ends[j]]) {
+                affected[ends[j]] = 1;
+                result.push_back(ends[j]);
+            }
+        }
+    }
+    // ֮ǰĲûеĶҲҪƶ
+    for(int v = previous.size(); v < n; v++) {
+        if (!affected[v]) {
+            affected[v] = 1;
+            result.push_back(v);
+        }
+    }
+    int begin = 0;
+    for(int step = 0; step < hops; step++) {
+        int end = result.size();
+        for(int i = begin; i < end; i++) {
+            int v = result[i];
+            const int* adj = graph.neighbors(v + 1);
+            for(int k = 0; k < graph.degree(v + 1); k++) {
+                int u = adj[k] - 1;
+                if (!affected[u]) {
+                    affected[u] = 1;
+                    result.push_back(u);
+                }
+            }
+        }
+        begin = end;
+    }
+    return result;
+}
+
+vector<Point2D> incrementalLayout(const SparseGraph &graph, const vector<Point2D> &previous,
+                                  const vector<EdgeDelta> &delta, const LayoutParams &params,
+                                  const IncrementalParams &incremental, int* movedCnt) {
+    int n = graph.vertexCount();
+    double k = sqrt(params.width * params.height / max(n, 1)); // ߳forceLayoutͬ
+    double k2 = k * k;
+    vector<char> affected;
+    vector<int> moving = affectedVertices(graph, previous, delta, incremental.hops, affected);
+    if (movedCnt != NULL)
+        *movedCnt = moving.size();
+
+    // ¶ھӵĸûھʱڻ
+    vector<Point2D> pos(n);
+    for(int v = 0; v < n && v < previous.size(); v++)
+        pos[v] = previous[v];
+    mt19937 random(params.seed);
+    uniform_real_distribution<double> jitter(-k / 2, k / 2);
+    for(int v = previous.size(); v < n; v++) {
+        double x = 0, y = 0;
+        int cnt = 0;
+        const int* adj = graph.neighbors(v + 1);
+        for(int i = 0; i < graph.degree(v + 1); i++) {
+            int u = adj[i] - 1;
+            if (u < previous.size()) {
+                x += previous[u].x;
+                y += previous[u].y;
+                cnt++;
+            }
+        }
+        if (cnt > 0) {
+            pos[v].x = x / cnt + jitter(random);
+            pos[v].y = y / cnt + jitter(random);
+        } else {
+            pos[v].x = uniform_real_distribution<double>(0, params.width)(random);
+            pos[v].y = uniform_real_distribution<double>(0, params.height)(random);
+        }
+    }
+    if (moving.empty())
+        return pos;
+
+    // ̶㲻ǵĲֻһ
+    vector<int> fixed;
+    fixed.reserve(n - moving.size());
+    for(int v = 0; v < n; v++) {
+        if (!affected[v])
+            fixed.push_back(v);
+    }
+    QuadTree fixedTree, movingTree;
+    fixedTree.build(pos, fixed);
+
+    vector<Point2D> disp(n);
+    for(int iter = 0; iter < incremental.iterations; iter++) {
+        double temperature = k * (1.0 - (double)iter / incremental.iterations); // ߳ʼ
+        movingTree.build(pos, moving);
+        for(int i = 0; i < moving.size(); i++) {
+            int v = moving[i];
+            disp[v].x = 0;
+            disp[v].y = 0;
+            if (!fixed.empty())
+                fixedTree.repulsion(pos, v, k2, params.theta, disp[v].x, disp[v].y, false);
+            movingTree.repulsion(pos, v, k2, params.theta, disp[v].x, disp[v].y);
+            // ֻӰ춥ı
+            const int* adj = graph.neighbors(v + 1);
+            for(int j = 0; j < graph.degree(v + 1); j++) {
+                int u = adj[j] - 1;
+                if (u == v)
+                    continue;
+                double dx = pos[v].x - pos[u].x;
+                double dy = pos[v].y - pos[u].y;
+                double factor = max(sqrt(dx * dx + dy * dy), 1e-2) / k;
+                disp[v].x -= dx * factor;
+                disp[v].y -= dy * factor;
+            }
+        }
+        for(int i = 0; i < moving.size(); i++) {
+            int v = moving[i];
+            double len = sqrt(disp[v].x * disp[v].x + disp[v].y * disp[v].y);
+            if (len > 0) {
+                double step = min(len, temperature);
+                pos[v].x += disp[v].x / len * step;
+                pos[v].y += disp[v].y / len * step;
+            }
+        }
+    }
+    return pos;
+}
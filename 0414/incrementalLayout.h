@@ -0,0 +1,48 @@
+#ifndef INC_0414_INCREMENTALLAYOUT_H
+#define INC_0414_INCREMENTALLAYOUT_H
+
+#include <string>
+#include <vector>
+#include "forceLayout.h"
+#include "sparseGraph.h"
+
+using namespace std;
+
+/* һߵı仯 */
+struct EdgeDelta {
+    bool add; // trueΪӱߣеı޸ȨֵfalseΪɾ
+    int u, v; // ˵㣬1ʼ
+    int weight; // ӱʱȨֵ
+};
+
+/* ֵĲ */
+struct IncrementalParams {
+    int hops; // 仯ıߵĶ˵㼰hopsڵھӿƶඥ̶
+    int iterations; // 
+    IncrementalParams() : hops(2), iterations(50) {};
+};
+
+// ļÿһ"x y"˳
+bool loadLayout(string filename, vector<Point2D> &pos);
+bool saveLayout(string filename, const vector<Point2D> &pos);
+
+// 仯ļÿ"+ u v [w]""- u v"#ͷΪעͣwʡʱΪ1д˾ͱ򷵻false
+bool loadDelta(string filename, vector<EdgeDelta> &delta);
+
+/*
+ * delta˳õgraphϣµͼѾfreeze
+ * ӱߵĶ˵㳬ʱԶӶ㣻ɾڵıʱԡ
+ */
+SparseGraph applyDelta(const SparseGraph &graph, const vector<EdgeDelta> &delta);
+
+/*
+ * ֣graphΪdelta֮ͼpreviousΪ֮ǰĲ֣Աgraph٣
+ * ֻӰĶ㣨IncrementalParams::hopsԭλÿʼƶ¶ھӵĸ
+ * ̶ĲֻһΣÿεֻӰĶӰĶͱȡ
+ * movedCntΪNULLʱӰĶ
+ */
+vector<Point2D> incrementalLayout(const SparseGraph &graph, const vector<Point2D> &previous,
+                                  const vector<EdgeDelta> &delta, const LayoutParams &params,
+                                  const IncrementalParams &incremental = IncrementalParams(), int* movedCnt = NULL);
+
+#endif //INC_0414_INCREMENTALLAYOUT_H
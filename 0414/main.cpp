@@ -1,59 +1,117 @@
 #include <iostream>
-#include "drawGraph_MATLAB.h"
+#include "sparseGraph.h"
+#include "graphImport.h"
+#include "incrementalLayout.h"
+#include "renderer.h"
+#include "graphAnalytics.h"
 using namespace std;
 
-void initGraph(int** graph, int n); // һͼڽӾʽ
-void drawGraphByMatlab(int** graph, int n, int cnt); // ͼ
+void initGraph(SparseGraph &graph); // һͼԱ߱ʽ
+void printGraph(SparseGraph &graph); // ڽӾ󣨶϶ʱֻ߱Ĺģ
+void printStats(const GraphStats &stats); // ͨͶֲ
 
-int main() {
-    int n;
-    cout << "붥ĸ";
-    cin >> n;
-    // ͼʼ
-    int *(*graph) = new int*[n];
-    for(int i = 0; i < n; i++) {
-        graph[i] = new int[n];
-        for(int j = 0; j < n; j++)
-            graph[i][j] = 0;
+int main(int argc, char* argv[]) {
+    SparseGraph graph;
+    DrawOptions options;
+    string filename; // ߱ļΪʱֶ
+    string deltaFile; // ߵı仯ļ
+    string rendererName; // ͼ
+    int initDelay = 0; // nullģĳʼʱ
+    bool giantOnly = false; // Ƿֻͨ
+    // demo0414 [ļ] [--threads N] [--multilevel] [--previous ļ --delta 仯ļ] [--tiles]
+    //          [--renderer matlab|native|null] [--init-delay ] [--giant]
+    for(int i = 1; i < argc; i++) {
+        if (string(argv[i]) == "--threads" && i + 1 < argc)
+            options.threads = atoi(argv[++i]);
+        else if (string(argv[i]) == "--multilevel")
+            options.multilevel = true;
+        else if (string(argv[i]) == "--previous" && i + 1 < argc)
+            options.previousLayout = argv[++i];
+        else if (string(argv[i]) == "--delta" && i + 1 < argc)
+            deltaFile = argv[++i];
+        else if (string(argv[i]) == "--tiles")
+            options.tiles = true;
+        else if (string(argv[i]) == "--renderer" && i + 1 < argc)
+            rendererName = argv[++i];
+        else if (string(argv[i]) == "--init-delay" && i + 1 < argc)
+            initDelay = atoi(argv[++i]);
+        else if (string(argv[i]) == "--giant")
+            giantOnly = true;
+        else if (filename.empty() && argv[i][0] != '-')
+            filename = argv[i];
     }
-    initGraph(graph, n);
 
-    // ͳƱߵĸ
-    int cnt = 0;
-    for(int i = 0; i < n; i++) {
-        for(int j = i; j < n; j++) {
-            if (graph[i][j] != 0)
-                cnt++;
+    // ͨĶ±ţ֮ǰĲֺͱ仯ļеıŶԲ
+    if (giantOnly && (!options.previousLayout.empty() || !deltaFile.empty())) {
+        cout << "--giant--previous--deltaһʹã" << endl;
+        return -1;
+    }
+    if (!deltaFile.empty() && filename.empty()) {
+        cout << "--deltaֻڴļͼ" << endl;
+        return -1;
+    }
+    if (giantOnly)
+        options.layoutFile = "giant.layout"; // ԭͼͬgraph.layout
+    if (!deltaFile.empty() && !loadDelta(deltaFile, options.delta)) {
+        cout << "޷ȡļ" << deltaFile << "" << endl;
+        return -1;
+    }
+
+    // ͼں̨ʼͼͬʱ
+    Renderer* renderer = createRenderer(rendererName, options, initDelay);
+    if (renderer == NULL) {
+        cout << "û" << rendererName << "ͼˣ" << endl;
+        return -1;
+    }
+    renderer->start();
+
+    int skippedCnt = 0; // ļʱ
+    if (!filename.empty()) {
+        if (!importGraph(filename, graph, FORMAT_AUTO, options.threads, &skippedCnt)) {
+            cout << "޷ȡļ" << filename << "" << endl;
+            delete renderer;
+            return -1;
         }
+        if (!deltaFile.empty())
+            graph = applyDelta(graph, options.delta);
+    } else {
+        int n;
+        cout << "붥ĸ";
+        cin >> n;
+        // ͼʼ
+        graph = SparseGraph(n);
+        initGraph(graph);
+        graph.freeze();
+    }
+    GraphStats stats = analyzeGraph(graph, options.threads);
+    printGraph(graph);
+    if (skippedCnt > 0)
+        cout << "" << skippedCnt << "޷򲻺Ϸı" << endl;
+    printStats(stats);
+    if (giantOnly && stats.componentCnt > 1) {
+        graph = largestComponent(graph, stats);
+        cout << "ֻͨ±ţֱ浽" << options.layoutFile << "" << endl;
     }
 
     // ͼ
-    drawGraphByMatlab(graph, n, cnt);
-    return 0;
+    bool drawn = renderer->draw(graph);
+    delete renderer;
+    return drawn ? 0 : -1;
 }
 
-void initGraph(int** graph, int n) {
-    graph[0][1] = 2;
-    graph[0][2] = 4;
-    graph[0][3] = 22;
-    graph[1][0] = 2;
-    graph[1][2] = 1;
-    graph[1][3] = 6;
-    graph[2][0] = 4;
-    graph[2][1] = 1;
-    graph[2][3] = 1;
-    graph[2][4] = 4;
-    graph[3][0] = 22;
-    graph[3][1] = 6;
-    graph[3][2] = 1;
-    graph[3][4] = 10;
-    graph[3][5] = 5;
-    graph[4][2] = 4;
-    graph[4][3] = 10;
-    graph[4][5] = 3;
-    graph[5][3] = 5;
-    graph[5][4] = 3;
+void initGraph(SparseGraph &graph) {
+    graph.addEdge(1, 2, 2);
+    graph.addEdge(1, 3, 4);
+    graph.addEdge(1, 4, 22);
+    graph.addEdge(2, 3, 1);
+    graph.addEdge(2, 4, 6);
+    graph.addEdge(3, 4, 1);
+    graph.addEdge(3, 5, 4);
+    graph.addEdge(4, 5, 10);
+    graph.addEdge(4, 6, 5);
+    graph.addEdge(5, 6, 3);
     /*
+    int n = graph.vertexCount();
     int rowCnt = 0;
     int colCnt = 0;
     while (rowCnt < n) {
@@ -76,59 +134,56 @@ void initGraph(int** graph, int n) {
             if (weight <= 0) {
                 cout << "ȨֵΪ" << endl;
             } else {
-                graph[rowCnt - 1][pos - 1] = weight;
-                graph[pos - 1][rowCnt - 1] = weight;
+                graph.addEdge(rowCnt, pos, weight);
                 colCnt++;
             }
         }
     }
      */
+}
+
+void printGraph(SparseGraph &graph) {
+    const int MATRIX_LIMIT = 30; // ڽӾ󶥵
+    int n = graph.vertexCount();
     system("cls");
+    if (n > MATRIX_LIMIT) {
+        cout << "" << n << "" << graph.edgeCount() << endl;
+        return;
+    }
     cout << "ڽӾΪ" << endl;
     cout << "\t";
     for(int i = 0; i < n; i++)
         cout << i + 1 << "\t";
     cout << endl;
-    for(int i = 0; i < n; i++) {
-        cout << i + 1 << "\t";
-        for(int j = 0; j < n; j++) {
-            cout << graph[i][j] << "\t";
+    vector<int> row(n + 1, 0);
+    for(int i = 1; i <= n; i++) {
+        const int* adj = graph.neighbors(i);
+        const int* weight = graph.neighborWeights(i);
+        for(int k = 0; k < graph.degree(i); k++)
+            row[adj[k]] = weight[k];
+        cout << i << "\t";
+        for(int j = 1; j <= n; j++) {
+            cout << row[j] << "\t";
+            row[j] = 0;
         }
         cout << endl;
     }
 }
 
-void drawGraphByMatlab(int** graph, int n, int cnt) {
-    int* s = new int[cnt];
-    int* t = new int[cnt];
-    int* w = new int[cnt];
-    int pos = 0;
-    for(int i = 0; i < n && pos < cnt; i++) {
-        for(int j = i; j < n && pos < cnt; j++) {
-            if (graph[i][j] != 0) {
-                s[pos] = i + 1;
-                t[pos] = j + 1;
-                w[pos] = graph[i][j];
-                pos++;
-            }
-        }
-    }
-
-    // ʼdrawGraph
-    if (!drawGraph_MATLABInitialize()) {
-        exit(-1);
+void printStats(const GraphStats &stats) {
+    cout << "ͨ" << stats.componentCnt << "" << stats.largestSize << "" << endl;
+    // 2ݷ
+    cout << "ֲ" << endl;
+    int low = 0;
+    for(int high = 1; low <= stats.maxDegree; high *= 2) {
+        int cnt = 0;
+        for(int d = low; d < high && d <= stats.maxDegree; d++)
+            cnt += stats.degreeHistogram[d];
+        int last = min(high - 1, stats.maxDegree);
+        if (cnt > 0 && last == low)
+            cout << "\t" << low << "" << cnt << endl;
+        else if (cnt > 0)
+            cout << "\t" << low << "~" << last << "" << cnt << endl;
+        low = high;
     }
-
-    mwArray s_mat(1, cnt, mxDOUBLE_CLASS);
-    s_mat.SetData(s, cnt);
-    mwArray t_mat(1, cnt, mxDOUBLE_CLASS);
-    t_mat.SetData(t, cnt);
-    mwArray w_mat(1, cnt, mxDOUBLE_CLASS);
-    w_mat.SetData(w, cnt);
-
-    drawGraph(s_mat, t_mat, w_mat);
-
-    system("pause");
-
-    drawGraph_MATLABTerminate();
-}
\ No newline at end of file
+}
@@ -0,0 +1,113 @@
+#include "multilevelLayout.h"
+#include <math.h>
+#include <random>
+#include <algorithm>
+
+// ֻһΣparent[v]Ϊv0ʼڴͼеıţشͼĶ
+static int coarsen(const SparseGraph &graph, mt19937 &random, vector<int> &parent) {
+    int n = graph.vertexCount();
+    vector<int> order(n);
+    for(int i = 0; i < n; i++)
+        order[i] = i;
+    shuffle(order.begin(), order.end(), random);
+
+    // ƥ䣺СδƥھӺϲ
+    parent.assign(n, -1);
+    int coarseCnt = 0;
+    for(int i = 0; i < n; i++) {
+        int v = order[i];
+        if (parent[v] >= 0)
+            continue;
+        const int* adj = graph.neighbors(v + 1);
+        int best = -1;
+        for(int k = 0; k < graph.degree(v + 1); k++) {
+            int u = adj[k] - 1;
+            if (u != v && parent[u] < 0 && (best < 0 || graph.degree(u + 1) < graph.degree(best + 1)))
+                best = u;
+        }
+        if (best >= 0) {
+            parent[v] = coarseCnt;
+            parent[best] = coarseCnt;
+            coarseCnt++;
+        }
+    }
+    // ûƥϵĶ㲢һƥھӣϲ
+    int lonely = -1;
+    for(int i = 0; i < n; i++) {
+        int v = order[i];
+        if (parent[v] >= 0)
+            continue;
+        const int* adj = graph.neighbors(v + 1);
+        for(int k = 0; k < graph.degree(v + 1) && parent[v] < 0; k++) {
+            int u = adj[k] - 1;
+            if (u != v && parent[u] >= 0)
+                parent[v] = parent[u];
+        }
+        if (parent[v] >= 0)
+            continue;
+        if (lonely >= 0) {
+            parent[v] = parent[lonely];
+            lonely = -1;
+        } else {
+            parent[v] = coarseCnt++;
+            lonely = v;
+        }
+    }
+    return coarseCnt;
+}
+
+// parentͼɴͼȥԻ
+static SparseGraph contract(const SparseGraph &graph, const vector<int> &parent, int coarseCnt) {
+    SparseGraph coarse(coarseCnt);
+    coarse.reserve(graph.edgeCount());
+    const int* s = graph.sources();
+    const int* t = graph.targets();
+    const int* w = graph.weights();
+    for(int e = 0; e < graph.edgeCount(); e++) {
+        int u = parent[s[e] - 1];
+        int v = parent[t[e] - 1];
+        if (u != v)
+            coarse.addEdge(u + 1, v + 1, w[e]);
+    }
+    coarse.freeze();
+    return coarse;
+}
+
+vector<Point2D> multilevelLayout(const SparseGraph &graph, const LayoutParams &params,
+                                 const MultilevelParams &multilevel) {
+    mt19937 random(params.seed);
+    vector<SparseGraph> levels; // ͼlevels[i]ɵi㣨0Ϊԭͼõ
+    vector<vector<int>> parents; // parents[i]i㶥levels[i]еı
+    const SparseGraph* current = &graph;
+    while (current->vertexCount() > multilevel.coarsestSize) {
+        vector<int> parent;
+        int coarseCnt = coarsen(*current, random, parent);
+        if (coarseCnt > current->vertexCount() * multilevel.minShrink)
+            break;
+        parents.push_back(parent);
+        levels.push_back(contract(*current, parent, coarseCnt)); // ٷ룬ݲӰcurrent
+        current = &levels.back();
+    }
+
+    // ֵһ
+    const SparseGraph &coarsest = levels.empty() ? graph : levels.back();
+    vector<Point2D> pos = forceLayout(coarsest.sources(), coarsest.targets(), coarsest.edgeCount(),
+                                      coarsest.vertexCount(), params);
+
+    // 㻹ԭϸ
+    for(int level = (int)levels.size() - 1; level >= 0; level--) {
+        const SparseGraph &fine = level == 0 ? graph : levels[level - 1];
+        const vector<int> &parent = parents[level];
+        double k = sqrt(params.width * params.height / fine.vertexCount()); // ϸͼ߳
+        uniform_real_distribution<double> jitter(-k / 2, k / 2);
+        vector<Point2D> finePos(fine.vertexCount());
+        for(int v = 0; v < fine.vertexCount(); v++) {
+            finePos[v].x = pos[parent[v]].x + jitter(random);
+            finePos[v].y = pos[parent[v]].y + jitter(random);
+        }
+        refineLayout(fine.sources(), fine.targets(), fine.edgeCount(), finePos, params,
+                     multilevel.refineIterations, 2 * k);
+        pos.swap(finePos);
+    }
+    return pos;
+}
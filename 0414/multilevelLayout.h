@@ -0,0 +1,29 @@
+#ifndef INC_0414_MULTILEVELLAYOUT_H
+#define INC_0414_MULTILEVELLAYOUT_H
+
+#include <vector>
+#include "forceLayout.h"
+#include "sparseGraph.h"
+
+using namespace std;
+
+/* 㲼ֵĲ */
+struct MultilevelParams {
+    int coarsestSize; // ֵʱֹֻͣ
+    double minShrink; // һδֻ󶥵ٽԭ£ֹֻͣ
+    int refineIterations; // ÿһϸʱĵ
+    MultilevelParams() : coarsestSize(50), minShrink(0.85), refineIterations(60) {};
+};
+
+/*
+ * 򲼾֣FM3˼·
+ *   1. ֻ˳ʶ㣬СδƥھӺϲûƥϵĶ㲢һƥھӣ̫ϵϲ
+ *      ϲ
+ *   2. ֵһforceLayout֣
+ *   3. 㻹ԭӶڸ㸽һȷƫƣrefineLayoutϸ
+ * graphѾfreezeص±0ʼ
+ */
+vector<Point2D> multilevelLayout(const SparseGraph &graph, const LayoutParams &params,
+                                 const MultilevelParams &multilevel = MultilevelParams());
+
+#endif //INC_0414_MULTILEVELLAYOUT_H
@@ -0,0 +1,155 @@
+#include "quadTree.h"
+#include <math.h>
+#include <algorithm>
+
+int QuadTree::newNode(double cx, double cy, double half) {
+    if (used == pool.size())
+        pool.push_back(QuadNode());
+    QuadNode &node = pool[used];
+    node.cx = cx;
+    node.cy = cy;
+    node.half = half;
+    node.sumX = 0;
+    node.sumY = 0;
+    node.mass = 0;
+    node.vertex = -1;
+    for(int q = 0; q < 4; q++)
+        node.child[q] = -1;
+    return used++;
+}
+
+// subsetΪNULLʱʹȫcnt
+void QuadTree::buildRoot(const vector<Point2D> &pos, const int* subset, int cnt) {
+    used = 0;
+    if (pool.size() < 2 * cnt)
+        pool.reserve(2 * cnt);
+    int first = subset == NULL ? 0 : subset[0];
+    double minX = pos[first].x, maxX = pos[first].x, minY = pos[first].y, maxY = pos[first].y;
+    for(int i = 1; i < cnt; i++) {
+        const Point2D &p = pos[subset == NULL ? i : subset[i]];
+        minX = min(minX, p.x);
+        maxX = max(maxX, p.x);
+        minY = min(minY, p.y);
+        maxY = max(maxY, p.y);
+    }
+    double half = max(maxX - minX, maxY - minY) / 2 + 1e-6;
+    newNode((minX + maxX) / 2, (minY + maxY) / 2, half);
+}
+
+void QuadTree::build(const vector<Point2D> &pos) {
+    used = 0;
+    if (pos.empty())
+        return;
+    buildRoot(pos, NULL, pos.size());
+    for(int i = 0; i < pos.size(); i++)
+        insert(pos, i);
+}
+
+void QuadTree::build(const vector<Point2D> &pos, const vector<int> &subset) {
+    used = 0;
+    if (subset.empty())
+        return;
+    buildRoot(pos, subset.data(), subset.size());
+    for(int i = 0; i < subset.size(); i++)
+        insert(pos, subset[i]);
+}
+
+// Ӹߣ;ۼߵҶʱ¶㣬ֻһҶʱ
+void QuadTree::insert(const vector<Point2D> &pos, int vertex) {
+    double x = pos[vertex].x;
+    double y = pos[vertex].y;
+    int current = 0;
+    for(int depth = 0; ; depth++) {
+        QuadNode* node = &pool[current];
+        node->mass++;
+        node->sumX += x;
+        node->sumY += y;
+        bool leaf = node->child[0] < 0 && node->child[1] < 0 && node->child[2] < 0 && node->child[3] < 0;
+        if (leaf) {
+            if (node->mass == 1) {
+                node->vertex = vertex;
+                return;
+            }
+            if (depth >= MAX_DEPTH) {
+                node->vertex = -1;
+                return;
+            }
+            // ԭĶƵӽ
+            int old = node->vertex;
+            node->vertex = -1;
+            if (old >= 0) {
+                int q = (pos[old].x >= node->cx ? 1 : 0) + (pos[old].y >= node->cy ? 2 : 0);
+                double h = node->half / 2;
+                int child = newNode(node->cx + (q & 1 ? h : -h), node->cy + (q & 2 ? h : -h), h);
+                node = &pool[current];
+                node->child[q] = child;
+                QuadNode &oldNode = pool[child];
+                oldNode.mass = 1;
+                oldNode.sumX = pos[old].x;
+                oldNode.sumY = pos[old].y;
+                oldNode.vertex = old;
+            }
+        }
+        int q = (x >= node->cx ? 1 : 0) + (y >= node->cy ? 2 : 0);
+        if (node->child[q] < 0) {
+            double h = node->half / 2;
+            int child = newNode(node->cx + (q & 1 ? h : -h), node->cy + (q & 2 ? h : -h), h);
+            pool[current].child[q] = child;
+        }
+        current = pool[current].child[q];
+    }
+}
+
+void QuadTree::repulsion(const vector<Point2D> &pos, int self, double k2, double theta, double &fx, double &fy,
+                         bool selfInTree) const {
+    if (used == 0)
+        return;
+    double x = pos[self].x;
+    double y = pos[self].y;
+    int stack[4 * MAX_DEPTH + 8];
+    int top = 0;
+    stack[top++] = 0;
+    while (top > 0) {
+        const QuadNode &node = pool[stack[--top]];
+        if (node.mass == 0 || node.vertex == self)
+            continue;
+        double mass = node.mass;
+        double comX = node.sumX;
+        double comY = node.sumY;
+        // selfʱȥԼĹ
+        bool inside = x >= node.cx - node.half && x < node.cx + node.half &&
+                      y >= node.cy - node.half && y < node.cy + node.half;
+        if (selfInTree && inside && node.vertex < 0) {
+            bool leaf = node.child[0] < 0 && node.child[1] < 0 && node.child[2] < 0 && node.child[3] < 0;
+            if (!leaf) {
+                for(int q = 0; q < 4; q++) {
+                    if (node.child[q] >= 0)
+                        stack[top++] = node.child[q];
+                }
+                continue;
+            }
+            mass -= 1;
+            comX -= x;
+            comY -= y;
+            if (mass <= 0)
+                continue;
+        }
+        comX /= mass;
+        comY /= mass;
+        double dx = x - comX;
+        double dy = y - comY;
+        double dist2 = max(dx * dx + dy * dy, 1e-4);
+        bool leaf = node.child[0] < 0 && node.child[1] < 0 && node.child[2] < 0 && node.child[3] < 0;
+        double size = 2 * node.half;
+        if (leaf || size * size < theta * theta * dist2) {
+            double factor = mass * k2 / dist2;
+            fx += dx * factor;
+            fy += dy * factor;
+        } else {
+            for(int q = 0; q < 4; q++) {
+                if (node.child[q] >= 0)
+                    stack[top++] = node.child[q];
+            }
+        }
+    }
+}
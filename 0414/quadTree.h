@@ -0,0 +1,43 @@
+#ifndef INC_0414_QUADTREE_H
+#define INC_0414_QUADTREE_H
+
+#include <vector>
+#include "forceLayout.h"
+
+using namespace std;
+
+/* Ĳ */
+struct QuadNode {
+    double cx, cy; // 
+    double half; // İ߳
+    double sumX, sumY; // ڶ֮ͣmassõ
+    int mass; // ڵĶ
+    int vertex; // ҶӽеĶţ-1ʾûлֹһ
+    int child[4]; // ĸڽе±꣬-1ʾΪ
+};
+
+/*
+ * Barnes-HutĲÿεbuild½ڸõĽУ
+ * ʱڴ棨ֻڶʱݣ
+ */
+class QuadTree {
+public:
+    QuadTree() : used(0) {};
+    ~QuadTree() {};
+    void build(const vector<Point2D> &pos); // ǰ½
+    void build(const vector<Point2D> &pos, const vector<int> &subset); // ֻsubsetеĶ㽨
+    // Զselfĳ k2 / d߳ /  < thetaʱһʵ㣻
+    // selfʱselfInTreeΪfalse
+    void repulsion(const vector<Point2D> &pos, int self, double k2, double theta, double &fx, double &fy,
+                   bool selfInTree = true) const;
+    int nodeCount() const { return used; }; // ǰʹõĽ
+private:
+    static const int MAX_DEPTH = 40; // ȣغϵĶ㵽һ㲻ϸ
+    vector<QuadNode> pool; // 
+    int used; // ʹõĽ
+    int newNode(double cx, double cy, double half); // ӽȡһ
+    void insert(const vector<Point2D> &pos, int vertex); // һ
+    void buildRoot(const vector<Point2D> &pos, const int* subset, int cnt); // ķΧ
+};
+
+#endif //INC_0414_QUADTREE_H
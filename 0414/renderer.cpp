@@ -0,0 +1,179 @@
+#include "renderer.h"
+#include <iostream>
+#include <chrono>
+#include <thread>
+#ifdef USE_MATLAB
+#include "drawGraph_MATLAB.h"
+#endif
+#include "forceLayout.h"
+#include "svgWriter.h"
+#include "multilevelLayout.h"
+#include "tileRenderer.h"
+
+void Renderer::start() {
+    if (started)
+        return;
+    started = true;
+    ready = async(launch::async, &Renderer::initialize, this).share();
+}
+
+bool Renderer::waitReady() {
+    if (!started)
+        return false;
+    return ready.get();
+}
+
+bool Renderer::draw(const SparseGraph &graph) {
+    if (!started) {
+        started = true;
+        promise<bool> result;
+        result.set_value(initialize());
+        ready = result.get_future().share();
+    }
+    if (!waitReady()) {
+        cout << name() << "˳ʼʧܣ" << endl;
+        return false;
+    }
+    return render(graph);
+}
+
+#ifdef USE_MATLAB
+/* MATLABdrawGraphͼ */
+class MatlabRenderer : public Renderer {
+public:
+    ~MatlabRenderer();
+    string name() const { return "matlab"; };
+protected:
+    bool initialize();
+    bool render(const SparseGraph &graph);
+};
+
+MatlabRenderer::~MatlabRenderer() {
+    if (waitReady())
+        drawGraph_MATLABTerminate();
+}
+
+bool MatlabRenderer::initialize() {
+    // ʼdrawGraphʱ
+    return drawGraph_MATLABInitialize();
+}
+
+bool MatlabRenderer::render(const SparseGraph &graph) {
+    int cnt = graph.edgeCount();
+    // SetDataֱӴӱ߱תMATLABdouble
+    mwArray s_mat(1, cnt, mxDOUBLE_CLASS);
+    s_mat.SetData(const_cast<int*>(graph.sources()), cnt);
+    mwArray t_mat(1, cnt, mxDOUBLE_CLASS);
+    t_mat.SetData(const_cast<int*>(graph.targets()), cnt);
+    mwArray w_mat(1, cnt, mxDOUBLE_CLASS);
+    w_mat.SetData(const_cast<int*>(graph.weights()), cnt);
+
+    drawGraph(s_mat, t_mat, w_mat);
+
+    system("pause");
+    return true;
+}
+#endif
+
+/* 򲼾ֻͼSVGļƬ */
+class NativeRenderer : public Renderer {
+public:
+    NativeRenderer(const DrawOptions &options) : options(options) {};
+    ~NativeRenderer() { waitReady(); };
+    string name() const { return "native"; };
+protected:
+    bool render(const SparseGraph &graph);
+private:
+    DrawOptions options;
+};
+
+// ֮ǰĲʱ֣򶥵϶ָ--multilevelʱʹö㲼ֱ֡浽options.layoutFileУ
+// ָ--tilesʱtilesĿ¼µƬ򻭳graph.svg
+bool NativeRenderer::render(const SparseGraph &graph) {
+    const int MULTILEVEL_LIMIT = 5000; // Զʹö㲼
+    int cnt = graph.edgeCount();
+    const int* s = graph.sources();
+    const int* t = graph.targets();
+    const int* w = graph.weights();
+
+    LayoutParams params;
+    params.threads = options.threads;
+    vector<Point2D> pos;
+    vector<Point2D> previous;
+    if (!options.previousLayout.empty() && !loadLayout(options.previousLayout, previous))
+        cout << "޷ȡļ" << options.previousLayout << "²" << endl;
+    if (!previous.empty()) {
+        int moved;
+        pos = incrementalLayout(graph, previous, options.delta, params, IncrementalParams(), &moved);
+        cout << "ƶ" << moved << "" << endl;
+    } else if (options.multilevel || graph.vertexCount() > MULTILEVEL_LIMIT)
+        pos = multilevelLayout(graph, params);
+    else
+        pos = forceLayout(s, t, cnt, graph.vertexCount(), params);
+    if (!saveLayout(options.layoutFile, pos))
+        cout << "޷д" << options.layoutFile << "" << endl;
+    if (options.tiles) {
+        TileParams tileParams;
+        tileParams.threads = options.threads;
+        int tileCnt = renderTiles(pos, s, t, cnt, tileParams);
+        if (tileCnt < 0) {
+            cout << "޷дƬ" << endl;
+            return false;
+        }
+        cout << "ѽͼ" << tileCnt << "Ƭ" << tileParams.directory << "Ŀ¼" << endl;
+    } else {
+        if (!writeSvg("graph.svg", pos, s, t, w, cnt, params.width, params.height)) {
+            cout << "޷дgraph.svg" << endl;
+            return false;
+        }
+        cout << "ѽͼgraph.svg" << endl;
+    }
+    return true;
+}
+
+/* ͼĺˣֻͳյıߣڲԺͼʱ */
+class NullRenderer : public Renderer {
+public:
+    NullRenderer(int initDelay) : initDelay(initDelay) {};
+    ~NullRenderer() { waitReady(); };
+    string name() const { return "null"; };
+protected:
+    bool initialize();
+    bool render(const SparseGraph &graph);
+private:
+    int initDelay; // ģĳʼʱ䣨룩
+};
+
+bool NullRenderer::initialize() {
+    this_thread::sleep_for(chrono::milliseconds(initDelay));
+    return true;
+}
+
+bool NullRenderer::render(const SparseGraph &graph) {
+    long long weightSum = 0;
+    const int* w = graph.weights();
+    for(int e = 0; e < graph.edgeCount(); e++)
+        weightSum += w[e];
+    cout << "nullյ" << graph.vertexCount() << "㡢" << graph.edgeCount() << "ߣȨֵΪ"
+         << weightSum << endl;
+    return true;
+}
+
+Renderer* createRenderer(string name, const DrawOptions &options, int initDelay) {
+    if (name.empty()) {
+#ifdef USE_MATLAB
+        name = "matlab";
+#else
+        name = "native";
+#endif
+    }
+#ifdef USE_MATLAB
+    if (name == "matlab")
+        return new MatlabRenderer();
+#endif
+    if (name == "native")
+        return new NativeRenderer(options);
+    if (name == "null")
+        return new NullRenderer(initDelay);
+    return NULL;
+}
@@ -0,0 +1,50 @@
+#ifndef INC_0414_RENDERER_H
+#define INC_0414_RENDERER_H
+
+#include <string>
+#include <vector>
+#include <future>
+#include "sparseGraph.h"
+#include "incrementalLayout.h"
+
+using namespace std;
+
+/*
+ * ͼˡstartںִ̨߳initializeMATLABʱ߳̿ͬʱ͹ͼ
+ * drawȳʼɺͼrenderֱ߱ʹgraphstw飬ơ
+ */
+class Renderer {
+public:
+    Renderer() : started(false) {};
+    virtual ~Renderer() {}; // ʱȵwaitReadyڳʼ̻߳ʱͷԴ
+    virtual string name() const = 0; // 
+    void start(); // ں̨߳̿ʼʼֻܵһ
+    bool draw(const SparseGraph &graph); // ȴʼɺͼûеstartʱͬʼ
+protected:
+    virtual bool initialize() { return true; }; // ʼںִ̨߳
+    virtual bool render(const SparseGraph &graph) = 0; // ͼڵdrawִ߳
+    bool waitReady(); // ȴʼɣǷɹ
+private:
+    bool started; // ǷѾʼʼ
+    shared_future<bool> ready; // ʼĽ
+};
+
+/* ԭͼѡ */
+struct DrawOptions {
+    bool multilevel; // Ƿʹö㲼
+    int threads; // ļͲʹõ߳
+    string previousLayout; // ֮ǰĲļdeltaһʹʱ
+    vector<EdgeDelta> delta; // ֮ǰĲ֣ͼбߵı仯
+    bool tiles; // Ƿ񻭳ƬSVG
+    string layoutFile; // ֱ浽ļ
+    DrawOptions() : multilevel(false), threads(1), tiles(false), layoutFile("graph.layout") {};
+};
+
+/*
+ * ˣ"matlab"ʱUSE_MATLABУ"native"򲼾֣SVGƬ
+ * "null"ͼֻͳƣûMATLABĻϲԣinitDelayģʱʱ䣩
+ * ΪʱUSE_MATLABmatlabnativeƲʶʱNULL
+ */
+Renderer* createRenderer(string name, const DrawOptions &options, int initDelay = 0);
+
+#endif //INC_0414_RENDERER_H
@@ -0,0 +1,101 @@
+#include "sparseGraph.h"
+#include <algorithm>
+
+SparseGraph::SparseGraph(int vertexCnt) {
+    this->n = vertexCnt;
+    this->isFrozen = false;
+}
+
+void SparseGraph::reserve(int edgeCnt) {
+    s.reserve(edgeCnt);
+    t.reserve(edgeCnt);
+    w.reserve(edgeCnt);
+}
+
+bool SparseGraph::addEdge(int u, int v, int weight) {
+    if (u <= 0 || v <= 0 || u > n || v > n || weight <= 0)
+        return false;
+    if (u > v)
+        swap(u, v);
+    s.push_back(u);
+    t.push_back(v);
+    w.push_back(weight);
+    isFrozen = false;
+    return true;
+}
+
+void SparseGraph::assignEdges(vector<int> &u, vector<int> &v, vector<int> &weight) {
+    s.swap(u);
+    t.swap(v);
+    w.swap(weight);
+    isFrozen = false;
+}
+
+void SparseGraph::setVertexCount(int vertexCnt) {
+    if (vertexCnt > n) {
+        n = vertexCnt;
+        isFrozen = false;
+    }
+}
+
+void SparseGraph::freeze() {
+    int m = s.size();
+    // ȶٰͬյȶ򣬽ɨڽӾ˳һ
+    vector<int> start(n + 2, 0);
+    for(int e = 0; e < m; e++)
+        start[s[e] + 1]++;
+    for(int v = 1; v <= n + 1; v++)
+        start[v] += start[v - 1];
+    vector<int> order(m);
+    vector<int> fill(start.begin(), start.end());
+    for(int e = 0; e < m; e++)
+        order[fill[s[e]]++] = e;
+    for(int v = 1; v <= n; v++) {
+        stable_sort(order.begin() + start[v], order.begin() + start[v + 1], [this](int a, int b) {
+            return t[a] < t[b];
+        });
+    }
+    // ȥظıߣȨֵ
+    vector<int> newS, newT, newW;
+    newS.reserve(m);
+    newT.reserve(m);
+    newW.reserve(m);
+    for(int i = 0; i < m; i++) {
+        int e = order[i];
+        if (!newS.empty() && newS.back() == s[e] && newT.back() == t[e]) {
+            newW.back() = w[e];
+        } else {
+            newS.push_back(s[e]);
+            newT.push_back(t[e]);
+            newW.push_back(w[e]);
+        }
+    }
+    s.swap(newS);
+    t.swap(newT);
+    w.swap(newW);
+    m = s.size();
+
+    // CSRÿ˵ϸһΣԻֻһΣ
+    offset.assign(n + 1, 0);
+    for(int e = 0; e < m; e++) {
+        offset[s[e]]++;
+        if (s[e] != t[e])
+            offset[t[e]]++;
+    }
+    for(int v = 1; v <= n; v++)
+        offset[v] += offset[v - 1];
+    adj.resize(offset[n]);
+    adjWeight.resize(offset[n]);
+    vector<int> pos(offset.begin(), offset.end() - 1);
+    for(int e = 0; e < m; e++) {
+        int u = s[e] - 1;
+        int v = t[e] - 1;
+        adj[pos[u]] = t[e];
+        adjWeight[pos[u]++] = w[e];
+        if (u != v) {
+            adj[pos[v]] = s[e];
+            adjWeight[pos[v]++] = w[e];
+        }
+    }
+    isFrozen = true;
+}
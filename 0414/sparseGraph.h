@@ -0,0 +1,45 @@
+#ifndef INC_0414_SPARSEGRAPH_H
+#define INC_0414_SPARSEGRAPH_H
+
+#include <vector>
+
+using namespace std;
+
+/*
+ * ϡͼʱһű߱freeze֮ȥظı߲CSRڽӱڴO(n + m)
+ * 1ʼţ߱drawGraphҪstw飨s <= tֱӽͼ
+ */
+class SparseGraph {
+public:
+    SparseGraph(int vertexCnt = 0); // 캯
+    ~SparseGraph() {}; // 
+    void reserve(int edgeCnt); // Ԥ߱ռ
+    bool addEdge(int u, int v, int weight); // һߣŲϷȨֵΪʱfalse
+    void assignEdges(vector<int> &u, vector<int> &v, vector<int> &weight); // ýķʽ滻߱÷֤ÿߺϷu <= v
+    void freeze(); // ȥزCSRظı߱Ȩֵ
+    void setVertexCount(int vertexCnt); // ޸Ķֻ
+
+    int vertexCount() const { return n; }; // 
+    int edgeCount() const { return s.size(); }; // ߵ
+    bool frozen() const { return isFrozen; }; // ǷѾCSR
+
+    // ߱es[e]t[e]ȨֵΪw[e]
+    const int* sources() const { return s.data(); };
+    const int* targets() const { return t.data(); };
+    const int* weights() const { return w.data(); };
+
+    // CSRڽӱv1ʼھΪadj[offset[v-1]]adj[offset[v]-1]ͬ1ʼ
+    int degree(int v) const { return offset[v] - offset[v - 1]; };
+    const int* neighbors(int v) const { return adj.data() + offset[v - 1]; };
+    const int* neighborWeights(int v) const { return adjWeight.data() + offset[v - 1]; };
+
+private:
+    int n; // 
+    vector<int> s, t, w; // ߱
+    vector<int> offset; // CSRÿʼλãΪn + 1
+    vector<int> adj; // CSRеھ
+    vector<int> adjWeight; // CSRеıȨ
+    bool isFrozen; // ǷѾCSR
+};
+
+#endif //INC_0414_SPARSEGRAPH_H
@@ -0,0 +1,68 @@
+#include "svgWriter.h"
+#include <cstdio>
+#include <algorithm>
+
+static const int LABEL_LIMIT = 200; // źȨֵ󶥵
+static const double MARGIN = 30; // ߾
+
+bool writeSvg(string filename, const vector<Point2D> &pos, const int* s, const int* t, const int* w, int edgeCnt,
+              double width, double height) {
+    FILE* file = fopen(filename.c_str(), "w");
+    if (file == NULL)
+        return false;
+    int n = pos.size();
+
+    // ȱŵ
+    double minX = 0, maxX = 1, minY = 0, maxY = 1;
+    if (n > 0) {
+        minX = maxX = pos[0].x;
+        minY = maxY = pos[0].y;
+    }
+    for(int i = 1; i < n; i++) {
+        minX = min(minX, pos[i].x);
+        maxX = max(maxX, pos[i].x);
+        minY = min(minY, pos[i].y);
+        maxY = max(maxY, pos[i].y);
+    }
+    double scale = min((width - 2 * MARGIN) / max(maxX - minX, 1e-9), (height - 2 * MARGIN) / max(maxY - minY, 1e-9));
+    vector<Point2D> p(n);
+    for(int i = 0; i < n; i++) {
+        p[i].x = MARGIN + (pos[i].x - minX) * scale;
+        p[i].y = MARGIN + (pos[i].y - minY) * scale;
+    }
+    bool labels = n <= LABEL_LIMIT;
+    double radius = labels ? 10 : 1.5;
+
+    fprintf(file, "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"%.0f\" height=\"%.0f\">\n", width, height);
+    fprintf(file, "<rect width=\"100%%\" height=\"100%%\" fill=\"white\"/>\n");
+    // б߷ͬһpathУļС
+    fprintf(file, "<path stroke=\"#4a6fa5\" stroke-width=\"%.1f\" fill=\"none\" d=\"", labels ? 1.5 : 0.3);
+    for(int e = 0; e < edgeCnt; e++) {
+        const Point2D &a = p[s[e] - 1];
+        const Point2D &b = p[t[e] - 1];
+        fprintf(file, "M%.1f %.1fL%.1f %.1f", a.x, a.y, b.x, b.y);
+    }
+    fprintf(file, "\"/>\n");
+    if (labels) {
+        fprintf(file, "<g font-size=\"12\" fill=\"#c0392b\" text-anchor=\"middle\">\n");
+        for(int e = 0; e < edgeCnt; e++) {
+            const Point2D &a = p[s[e] - 1];
+            const Point2D &b = p[t[e] - 1];
+            fprintf(file, "<text x=\"%.1f\" y=\"%.1f\">%d</text>\n", (a.x + b.x) / 2, (a.y + b.y) / 2 - 3, w[e]);
+        }
+        fprintf(file, "</g>\n");
+    }
+    fprintf(file, "<g fill=\"#1f3b63\">\n");
+    for(int i = 0; i < n; i++)
+        fprintf(file, "<circle cx=\"%.1f\" cy=\"%.1f\" r=\"%.1f\"/>\n", p[i].x, p[i].y, radius);
+    fprintf(file, "</g>\n");
+    if (labels) {
+        fprintf(file, "<g font-size=\"12\" fill=\"white\" text-anchor=\"middle\">\n");
+        for(int i = 0; i < n; i++)
+            fprintf(file, "<text x=\"%.1f\" y=\"%.1f\">%d</text>\n", p[i].x, p[i].y + 4, i + 1);
+        fprintf(file, "</g>\n");
+    }
+    fprintf(file, "</svg>\n");
+    fclose(file);
+    return true;
+}
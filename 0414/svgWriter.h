@@ -0,0 +1,17 @@
+#ifndef INC_0414_SVGWRITER_H
+#define INC_0414_SVGWRITER_H
+
+#include <string>
+#include <vector>
+#include "forceLayout.h"
+
+using namespace std;
+
+/*
+ * ѲֽSVGļŵwidth * heightĻϡ
+ * LABEL_LIMITʱźͱߵȨֵֻߡ
+ */
+bool writeSvg(string filename, const vector<Point2D> &pos, const int* s, const int* t, const int* w, int edgeCnt,
+              double width, double height);
+
+#endif //INC_0414_SVGWRITER_H
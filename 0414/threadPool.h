@@ -0,0 +1,36 @@
+#ifndef INC_0414_THREADPOOL_H
+#define INC_0414_THREADPOOL_H
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+
+using namespace std;
+
+/* ̶̳߳߳أ߳Ҳִ */
+class ThreadPool {
+public:
+    explicit ThreadPool(int threads); // threadsΪ߳ڵ߳
+    ~ThreadPool(); // ȴ߳˳
+    int size() const { return workers.size() + 1; }; // ߳
+    // ִtask(0)task(taskCnt - 1)ȫɺ󷵻أͬһʱֻһparallelFor
+    void parallelFor(int taskCnt, const function<void(int)> &task);
+private:
+    vector<thread> workers; // ߳
+    mutex lock;
+    condition_variable wake; // ʱѹ߳
+    condition_variable done; // ߳ȫʱѵ߳
+    const function<void(int)>* job; // ǰ
+    int jobCnt; // ǰ
+    atomic<int> next; // һҪִе
+    int busy; // ûɱֵĹ߳
+    int generation; // ڼ¾
+    bool stopping; // Ƿ
+    void workerLoop(); // ̵߳ѭ
+    void runTasks(); // ȡֱִûʣ
+};
+
+#endif //INC_0414_THREADPOOL_H
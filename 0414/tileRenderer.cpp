@@ -0,0 +1,288 @@
+#include "tileRenderer.h"
+#include "threadPool.h"
+#include "Bmp.h"
+#include <cstdio>
+#include <cerrno>
+#include <math.h>
+#include <algorithm>
+#include <unordered_map>
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#endif
+
+static const int TILE = 256; // Ƭ߳
+static const int AGG_PIXELS = 4; // ּۺϱʱı߳أ
+static const int MAX_ZOOM = 10; // żޣ֤ۺıŲ2^30
+static const double MARGIN = 0.02; // ռͼı
+static const BYTE INK[3] = {165, 111, 74}; // ߺͶɫ#4a6fa5BGR˳
+
+/* ĳһϵһ߶ΣΪһȫ */
+struct TileEdge {
+    double x0, y0, x1, y1;
+    float alpha; // ͸ȣߵʱۼ
+};
+
+static bool makeDirectory(const string &path) {
+#ifdef _WIN32
+    return _mkdir(path.c_str()) == 0 || errno == EEXIST;
+#else
+    return mkdir(path.c_str(), 0755) == 0 || errno == EEXIST;
+#endif
+}
+
+// tile * tileīˮд24λBMPinkĵ0
+static bool writeTile(const string &filename, const vector<float> &ink) {
+    FILE* fp = fopen(filename.c_str(), "wb");
+    if (fp == NULL)
+        return false;
+    WORD bfType = 0x4d42;
+    DWORD imageSize = TILE * TILE * 3; // ÿ768ֽڣҪ
+    BITMAPFILEHEADER fileHeader;
+    fileHeader.bfSize = sizeof(WORD) + sizeof(BITMAPFILEHEADER) + sizeof(BITMAPINFOHEADER) + imageSize;
+    fileHeader.bfReserved1 = 0;
+    fileHeader.bfReserved2 = 0;
+    fileHeader.bfOffBits = sizeof(WORD) + sizeof(BITMAPFILEHEADER) + sizeof(BITMAPINFOHEADER);
+    BITMAPINFOHEADER infoHeader;
+    infoHeader.biSize = sizeof(BITMAPINFOHEADER);
+    infoHeader.biWidth = TILE;
+    infoHeader.biHeight = TILE;
+    infoHeader.biPlanes = 1;
+    infoHeader.biBitCount = 24;
+    infoHeader.biCompression = 0;
+    infoHeader.biSizeImage = imageSize;
+    infoHeader.biXPelsPerMeter = 2835;
+    infoHeader.biYPelsPerMeter = 2835;
+    infoHeader.biClrUsed = 0;
+    infoHeader.biClrImportant = 0;
+    fwrite(&bfType, 1, sizeof(WORD), fp);
+    fwrite(&fileHeader, 1, sizeof(BITMAPFILEHEADER), fp);
+    fwrite(&infoHeader, 1, sizeof(BITMAPINFOHEADER), fp);
+
+    // BMPһпʼ
+    vector<IMAGEDATA> row(TILE);
+    for(int y = TILE - 1; y >= 0; y--) {
+        for(int x = 0; x < TILE; x++) {
+            float a = min(ink[y * TILE + x], 1.0f);
+            row[x].blue = (BYTE)(255 + (INK[0] - 255) * a);
+            row[x].green = (BYTE)(255 + (INK[1] - 255) * a);
+            row[x].red = (BYTE)(255 + (INK[2] - 255) * a);
+        }
+        fwrite(row.data(), sizeof(IMAGEDATA), TILE, fp);
+    }
+    bool ok = !ferror(fp);
+    fclose(fp);
+    return ok;
+}
+
+// Liang-Barskyü[0, TILE]^2߶ȫʱfalse
+static bool clipLine(double &x0, double &y0, double &x1, double &y1) {
+    double t0 = 0, t1 = 1;
+    double dx = x1 - x0, dy = y1 - y0;
+    double p[4] = {-dx, dx, -dy, dy};
+    double q[4] = {x0, TILE - x0, y0, TILE - y0};
+    for(int i = 0; i < 4; i++) {
+        if (p[i] == 0) {
+            if (q[i] < 0)
+                return false;
+        } else {
+            double r = q[i] / p[i];
+            if (p[i] < 0)
+                t0 = max(t0, r);
+            else
+                t1 = min(t1, r);
+        }
+    }
+    if (t0 > t1)
+        return false;
+    x1 = x0 + t1 * dx;
+    y1 = y0 + t1 * dy;
+    x0 = x0 + t0 * dx;
+    y0 = y0 + t0 * dy;
+    return true;
+}
+
+// Ƭڻ߶ΣƬϽǣÿؼalpha
+static void drawLine(vector<float> &ink, double x0, double y0, double x1, double y1, float alpha) {
+    if (!clipLine(x0, y0, x1, y1))
+        return;
+    int steps = max((int)ceil(max(fabs(x1 - x0), fabs(y1 - y0))), 1);
+    for(int i = 0; i <= steps; i++) {
+        int x = (int)(x0 + (x1 - x0) * i / steps);
+        int y = (int)(y0 + (y1 - y0) * i / steps);
+        if (x >= 0 && x < TILE && y >= 0 && y < TILE)
+            ink[y * TILE + x] += alpha;
+    }
+}
+
+// Amanatides-Wooķ߶αƬ(Ƭ, ߱)bins
+static void binLine(const TileEdge &edge, int edgeIndex, int tilesPerAxis, vector<pair<int, int>> &bins) {
+    double x0 = edge.x0 / TILE, y0 = edge.y0 / TILE, x1 = edge.x1 / TILE, y1 = edge.y1 / TILE;
+    int tx = min((int)x0, tilesPerAxis - 1), ty = min((int)y0, tilesPerAxis - 1);
+    int endX = min((int)x1, tilesPerAxis - 1), endY = min((int)y1, tilesPerAxis - 1);
+    double dx = x1 - x0, dy = y1 - y0;
+    int stepX = dx > 0 ? 1 : -1, stepY = dy > 0 ? 1 : -1;
+    double maxX = dx == 0 ? INFINITY : ((tx + (stepX > 0)) - x0) / dx;
+    double maxY = dy == 0 ? INFINITY : ((ty + (stepY > 0)) - y0) / dy;
+    double deltaX = dx == 0 ? INFINITY : 1 / fabs(dx);
+    double deltaY = dy == 0 ? INFINITY : 1 / fabs(dy);
+    int remain = abs(endX - tx) + abs(endY - ty); // ôಽ
+    while (true) {
+        bins.push_back(make_pair(ty * tilesPerAxis + tx, edgeIndex));
+        if (remain-- <= 0 || (tx == endX && ty == endY))
+            break;
+        if (maxX < maxY) {
+            maxX += deltaX;
+            tx += stepX;
+        } else {
+            maxY += deltaY;
+            ty += stepY;
+        }
+        if (tx < 0 || tx >= tilesPerAxis || ty < 0 || ty >= tilesPerAxis)
+            break;
+    }
+}
+
+// ƬCSRķͰݵƬ
+static vector<int> groupBins(vector<pair<int, int>> &bins, vector<int> &begin) {
+    sort(bins.begin(), bins.end());
+    vector<int> tiles;
+    begin.clear();
+    for(int i = 0; i < bins.size(); i++) {
+        if (i == 0 || bins[i].first != bins[i - 1].first) {
+            tiles.push_back(bins[i].first);
+            begin.push_back(i);
+        }
+    }
+    begin.push_back(bins.size());
+    return tiles;
+}
+
+int renderTiles(const vector<Point2D> &pos, const int* s, const int* t, int edgeCnt, const TileParams &params) {
+    int n = pos.size();
+    if (n == 0 || !makeDirectory(params.directory))
+        return n == 0 ? 0 : -1;
+
+    // ͼŽһΣzı߳ΪTILE * 2^z
+    double minX = pos[0].x, maxX = pos[0].x, minY = pos[0].y, maxY = pos[0].y;
+    for(int i = 1; i < n; i++) {
+        minX = min(minX, pos[i].x);
+        maxX = max(maxX, pos[i].x);
+        minY = min(minY, pos[i].y);
+        maxY = max(maxY, pos[i].y);
+    }
+    double side = max(max(maxX - minX, maxY - minY), 1e-9);
+    minX -= (side - (maxX - minX)) / 2 + side * MARGIN;
+    minY -= (side - (maxY - minY)) / 2 + side * MARGIN;
+    side *= 1 + 2 * MARGIN;
+
+    // Զѡʱ󼶱϶ƽԼΪ8
+    int maxZoom = params.maxZoom;
+    if (maxZoom < 0) {
+        maxZoom = 0;
+        while (maxZoom < MAX_ZOOM && TILE << maxZoom < 8 * sqrt((double)n))
+            maxZoom++;
+    }
+    maxZoom = min(maxZoom, MAX_ZOOM);
+
+    ThreadPool pool(params.threads);
+    int written = 0;
+    vector<Point2D> pixel(n);
+    for(int z = 0; z <= maxZoom; z++) {
+        int tilesPerAxis = 1 << z;
+        double scale = (double)TILE * tilesPerAxis / side;
+        for(int i = 0; i < n; i++) {
+            pixel[i].x = (pos[i].x - minX) * scale;
+            pixel[i].y = (pos[i].y - minY) * scale;
+        }
+
+        // ּۺϱߣ󼶱ԭʼı
+        vector<TileEdge> edges;
+        if (z < maxZoom) {
+            int cellsPerAxis = TILE * tilesPerAxis / AGG_PIXELS;
+            unordered_map<long long, int> bundles;
+            for(int e = 0; e < edgeCnt; e++) {
+                int u = s[e] - 1, v = t[e] - 1;
+                long long cu = min((int)(pixel[u].y / AGG_PIXELS), cellsPerAxis - 1) * (long long)cellsPerAxis +
+                               min((int)(pixel[u].x / AGG_PIXELS), cellsPerAxis - 1);
+                long long cv = min((int)(pixel[v].y / AGG_PIXELS), cellsPerAxis - 1) * (long long)cellsPerAxis +
+                               min((int)(pixel[v].x / AGG_PIXELS), cellsPerAxis - 1);
+                if (cu != cv)
+                    bundles[min(cu, cv) << 30 | max(cu, cv)]++;
+            }
+            edges.reserve(bundles.size());
+            for(unordered_map<long long, int>::iterator it = bundles.begin(); it != bundles.end(); ++it) {
+                long long cu = it->first >> 30, cv = it->first & ((1 << 30) - 1);
+                TileEdge edge;
+                edge.x0 = (cu % cellsPerAxis + 0.5) * AGG_PIXELS;
+                edge.y0 = (cu / cellsPerAxis + 0.5) * AGG_PIXELS;
+                edge.x1 = (cv % cellsPerAxis + 0.5) * AGG_PIXELS;
+                edge.y1 = (cv / cellsPerAxis + 0.5) * AGG_PIXELS;
+                edge.alpha = min(1.0, 0.25 + 0.25 * log2((double)it->second));
+                edges.push_back(edge);
+            }
+        } else {
+            edges.resize(edgeCnt);
+            for(int e = 0; e < edgeCnt; e++) {
+                edges[e].x0 = pixel[s[e] - 1].x;
+                edges[e].y0 = pixel[s[e] - 1].y;
+                edges[e].x1 = pixel[t[e] - 1].x;
+                edges[e].y1 = pixel[t[e] - 1].y;
+                edges[e].alpha = 0.6f;
+            }
+        }
+
+        // ߰ƬͰıȡһ
+        vector<pair<int, int>> bins;
+        for(int e = 0; e < edges.size(); e++)
+            binLine(edges[e], e, tilesPerAxis, bins);
+        for(int i = 0; i < n; i++) {
+            int tx = min((int)(pixel[i].x / TILE), tilesPerAxis - 1);
+            int ty = min((int)(pixel[i].y / TILE), tilesPerAxis - 1);
+            bins.push_back(make_pair(ty * tilesPerAxis + tx, -i - 1));
+        }
+        vector<int> begin;
+        vector<int> tiles = groupBins(bins, begin);
+
+        // ȴнĿ¼ٲлƬ
+        string levelDir = params.directory + "/" + to_string(z);
+        if (!makeDirectory(levelDir))
+            return -1;
+        vector<char> columnMade(tilesPerAxis, 0);
+        for(int i = 0; i < tiles.size(); i++) {
+            int tx = tiles[i] % tilesPerAxis;
+            if (!columnMade[tx] && !makeDirectory(levelDir + "/" + to_string(tx)))
+                return -1;
+            columnMade[tx] = 1;
+        }
+        float dotAlpha = z == maxZoom ? 1.0f : 0.5f;
+        int dotRadius = z == maxZoom ? 1 : 0;
+        vector<char> ok(tiles.size(), 0);
+        pool.parallelFor(tiles.size(), [&](int i) {
+            int tx = tiles[i] % tilesPerAxis, ty = tiles[i] / tilesPerAxis;
+            double originX = tx * TILE, originY = ty * TILE;
+            vector<float> ink(TILE * TILE, 0);
+            for(int k = begin[i]; k < begin[i + 1]; k++) {
+                int item = bins[k].second;
+                if (item >= 0) {
+                    const TileEdge &edge = edges[item];
+                    drawLine(ink, edge.x0 - originX, edge.y0 - originY, edge.x1 - originX, edge.y1 - originY,
+                             edge.alpha);
+                } else {
+                    int px = (int)(pixel[-item - 1].x - originX), py = (int)(pixel[-item - 1].y - originY);
+                    for(int y = max(py - dotRadius, 0); y <= min(py + dotRadius, TILE - 1); y++)
+                        for(int x = max(px - dotRadius, 0); x <= min(px + dotRadius, TILE - 1); x++)
+                            ink[y * TILE + x] += dotAlpha;
+                }
+            }
+            ok[i] = writeTile(levelDir + "/" + to_string(tx) + "/" + to_string(ty) + ".bmp", ink);
+        });
+        for(int i = 0; i < tiles.size(); i++) {
+            if (!ok[i])
+                return -1;
+            written++;
+        }
+    }
+    return written;
+}
@@ -0,0 +1,26 @@
+#ifndef INC_0414_TILERENDERER_H
+#define INC_0414_TILERENDERER_H
+
+#include <string>
+#include <vector>
+#include "forceLayout.h"
+
+using namespace std;
+
+/* ƬĲ */
+struct TileParams {
+    string directory; // Ŀ¼Ƭдdirectory/z/x/y.bmp
+    int maxZoom; // ż𣨵zΪ2^z * 2^zƬС0ʱԶѡ
+    int threads; // лƬ߳
+    TileParams() : directory("tiles"), maxZoom(-1), threads(1) {};
+};
+
+/*
+ * Ѳֽ256 * 256BMPƬ0һƬװͼÿһ߳
+ * 󼶱ֵĸѶ˵4صϣͬһԸӵıߺϲһԽɫԽ
+ * 󼶱ԭʼıߡÿıȰƬͰ̳߳ƬйդûݵƬд
+ * stdrawGraphĲͬȨӰơдƬʧʱ-1
+ */
+int renderTiles(const vector<Point2D> &pos, const int* s, const int* t, int edgeCnt, const TileParams &params);
+
+#endif //INC_0414_TILERENDERER_H
@@ -0,0 +1,108 @@
+#include "allPairs.h"
+#include "shortestPath.h"
+#include "threadPool.h"
+#include <atomic>
+#include <algorithm>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
+static const int ROW_BLOCK = 16; // ÿ
+
+#ifdef _WIN32
+bool DistanceMatrix::create(int vertexCnt, string filename) {
+    release();
+    n = vertexCnt;
+    size_t bytes = (size_t)n * n * sizeof(int);
+    if (filename.empty() || bytes == 0) {
+        data = new int[(size_t)n * n];
+        return true;
+    }
+    file = CreateFileA(filename.c_str(), GENERIC_READ | GENERIC_WRITE, 0, NULL, CREATE_ALWAYS,
+                       FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        file = NULL;
+        return false;
+    }
+    mapping = CreateFileMappingA(file, NULL, PAGE_READWRITE, (DWORD)(bytes >> 32), (DWORD)bytes, NULL);
+    if (mapping == NULL)
+        return false;
+    data = (int*)MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, bytes);
+    mapped = data != NULL;
+    return mapped;
+}
+
+void DistanceMatrix::release() {
+    if (mapped)
+        UnmapViewOfFile(data);
+    else
+        delete[] data;
+    if (mapping != NULL)
+        CloseHandle(mapping);
+    if (file != NULL)
+        CloseHandle(file);
+    data = NULL;
+    mapping = NULL;
+    file = NULL;
+    mapped = false;
+}
+#else
+bool DistanceMatrix::create(int vertexCnt, string filename) {
+    release();
+    n = vertexCnt;
+    size_t bytes = (size_t)n * n * sizeof(int);
+    if (filename.empty() || bytes == 0) {
+        data = new int[(size_t)n * n];
+        return true;
+    }
+    int fd = open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+        return false;
+    if (ftruncate(fd, bytes) != 0) {
+        ::close(fd);
+        return false;
+    }
+    void* addr = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd); // ӳ佨Թرļ
+    if (addr == MAP_FAILED)
+        return false;
+    data = (int*)addr;
+    mapped = true;
+    return true;
+}
+
+void DistanceMatrix::release() {
+    if (mapped)
+        munmap(data, (size_t)n * n * sizeof(int));
+    else
+        delete[] data;
+    data = NULL;
+    mapped = false;
+}
+#endif
+
+void allPairs(const CsrGraph &G, DistanceMatrix &matrix, int threads) {
+    int n = G.vertexCount();
+    ThreadPool pool(threads);
+    int workers = pool.size();
+    int blockCnt = (n + ROW_BLOCK - 1) / ROW_BLOCK;
+    atomic<int> nextBlock(0);
+    // ÿһߣԼѭȡпֱ
+    pool.parallelFor(workers, [&](int) {
+        DijkstraSearch search(G);
+        while (true) {
+            int block = nextBlock.fetch_add(1);
+            if (block >= blockCnt)
+                break;
+            int end = min((block + 1) * ROW_BLOCK, n);
+            for(int source = block * ROW_BLOCK; source < end; source++) {
+                search.run(source);
+                copy(search.distances().begin(), search.distances().end(), matrix.row(source));
+            }
+        }
+    });
+}
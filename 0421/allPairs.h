@@ -0,0 +1,41 @@
+#ifndef INC_0421_ALLPAIRS_H
+#define INC_0421_ALLPAIRS_H
+
+#include <string>
+#include "csrGraph.h"
+
+using namespace std;
+
+/*
+ * n * nľ󣬰ţiǴӶiľ롣
+ * ԷڴУҲӳ䵽ļļݾǰеn * nintûļͷ󳬹ڴʱúߡ
+ */
+class DistanceMatrix {
+public:
+    DistanceMatrix() : n(0), data(NULL), mapped(false) {};
+    ~DistanceMatrix() { release(); };
+    bool create(int vertexCnt, string filename = ""); // filenameΪʱӳ䵽ļ
+    int size() const { return n; };
+    int* row(int i) { return data + (size_t)i * n; };
+    const int* row(int i) const { return data + (size_t)i * n; };
+private:
+    int n; // 
+    int* data; // 
+    bool mapped; // Ƿӳ䵽ļ
+    void release(); // ͷڴӳ
+#ifdef _WIN32
+    void* file = NULL;
+    void* mapping = NULL;
+#endif
+    DistanceMatrix(const DistanceMatrix &); // 
+    DistanceMatrix &operator=(const DistanceMatrix &);
+};
+
+/*
+ * ж֮·аROW_BLOCKзֿ飬̳߳е߳ȡ
+ * ÿ߳ԼDijkstraSearchѡdisȻֻһΣԿÿԴԴ·ֱдĶӦС
+ * дǾвཻ֮߳䲻Ҫͬ
+ */
+void allPairs(const CsrGraph &G, DistanceMatrix &matrix, int threads);
+
+#endif //INC_0421_ALLPAIRS_H
@@ -0,0 +1,104 @@
+#include "altSearch.h"
+#include "shortestPath.h"
+#include "threadPool.h"
+#include <random>
+#include <algorithm>
+
+void Landmarks::build(const CsrGraph &G, const CsrGraph &reverse, int landmarkCnt, int threads) {
+    n = G.vertexCount();
+    landmarks.clear();
+    landmarkCnt = min(landmarkCnt, n);
+    from.assign((size_t)landmarkCnt * n, INF);
+    to.assign((size_t)landmarkCnt * n, INF);
+    if (landmarkCnt == 0)
+        return;
+
+    // Զ㷨ѡر꣺nearest[v]Ϊvѡر
+    DijkstraSearch search(G);
+    mt19937 random(1);
+    search.run(uniform_int_distribution<int>(0, n - 1)(random));
+    vector<int> nearest(search.distances());
+    for(int v = 0; v < n; v++) {
+        if (nearest[v] == INF)
+            nearest[v] = -1; // 㵽˵Ķ㲻һѡ
+    }
+    for(int i = 0; i < landmarkCnt; i++) {
+        int best = max_element(nearest.begin(), nearest.end()) - nearest.begin();
+        landmarks.push_back(best);
+        search.run(best);
+        copy(search.distances().begin(), search.distances().end(), from.begin() + (size_t)i * n);
+        if (i == 0)
+            nearest.assign(n, INF);
+        for(int v = 0; v < n; v++)
+            nearest[v] = min(nearest[v], search.distance(v));
+        for(int k = 0; k <= i; k++)
+            nearest[landmarks[k]] = -1; // Ѿǵر
+    }
+
+    // ڷͼ㵽رľ룬ر֮以أм
+    ThreadPool pool(threads);
+    int workers = pool.size();
+    pool.parallelFor(workers, [&](int worker) {
+        DijkstraSearch backward(reverse);
+        for(int i = worker; i < landmarkCnt; i += workers) {
+            backward.run(landmarks[i]);
+            copy(backward.distances().begin(), backward.distances().end(), to.begin() + (size_t)i * n);
+        }
+    });
+}
+
+int Landmarks::lowerBound(int v, int target) const {
+    int bound = 0;
+    for(int i = 0; i < landmarks.size(); i++) {
+        const int* f = from.data() + (size_t)i * n;
+        const int* t = to.data() + (size_t)i * n;
+        // һ߲ɴʱر½
+        if (f[v] != INF && f[target] != INF)
+            bound = max(bound, f[target] - f[v]);
+        if (t[v] != INF && t[target] != INF)
+            bound = max(bound, t[v] - t[target]);
+    }
+    return bound;
+}
+
+AltSearch::AltSearch(const CsrGraph &G, const Landmarks &landmarks)
+        : G(G), landmarks(landmarks), generation(0), stamp(G.vertexCount(), 0),
+          settledStamp(G.vertexCount(), 0), dis(G.vertexCount()), pred(G.vertexCount()),
+          bound(G.vertexCount()), heap(G.vertexCount()), settledCnt(0) {}
+
+int AltSearch::query(int source, int target, vector<int>* path) {
+    generation++;
+    settledCnt = 0;
+    heap.clear();
+    stamp[source] = generation;
+    dis[source] = 0;
+    pred[source] = -1;
+    bound[source] = landmarks.lowerBound(source, target);
+    heap.push(source, bound[source]);
+    while (!heap.empty()) {
+        int v = heap.pop();
+        settledStamp[v] = generation;
+        settledCnt++;
+        if (v == target)
+            break;
+        for(int e = G.begin(v); e < G.end(v); e++) {
+            int u = G.head(e);
+            if (settledStamp[u] == generation)
+                continue;
+            int nd = WeightTraits<int>::add(dis[v], G.cost(e));
+            if (stamp[u] != generation) {
+                stamp[u] = generation;
+                bound[u] = landmarks.lowerBound(u, target);
+            } else if (nd >= dis[u])
+                continue;
+            dis[u] = nd;
+            pred[u] = v;
+            heap.pushOrDecrease(u, WeightTraits<int>::add(nd, bound[u]));
+        }
+    }
+    if (settledStamp[target] != generation)
+        return INF;
+    if (path != NULL)
+        buildPath(pred, target, *path);
+    return dis[target];
+}
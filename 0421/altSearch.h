@@ -0,0 +1,57 @@
+#ifndef INC_0421_ALTSEARCH_H
+#define INC_0421_ALTSEARCH_H
+
+#include <vector>
+#include "csrGraph.h"
+#include "dAryHeap.h"
+
+using namespace std;
+
+/*
+ * ALTĵر;ÿرLd(L, v)d(v, L)رš
+ * ǲʽd(v, t) >= d(L, t) - d(L, v)d(v, t) >= d(v, L) - d(t, L)еرȡֵΪvt½硣
+ * ÿ½綼һµƺȡֵȻһ£A*Ҫظȷ㡣
+ */
+class Landmarks {
+public:
+    Landmarks() : n(0) {};
+    /*
+     * ѡlandmarkCntر꣨Զ㷨һԶĶ㣬֮ÿѡѡرĶ㣬
+     * еر궼˵Ķȣÿֵֶͨرꡣѡرʱ˳õd(L, v)
+     * ѡ̳߳ضÿرڷͼϲd(v, L)reverseΪG.reversed()
+     */
+    void build(const CsrGraph &G, const CsrGraph &reverse, int landmarkCnt, int threads);
+    int count() const { return landmarks.size(); };
+    int landmark(int i) const { return landmarks[i]; };
+    int lowerBound(int v, int target) const; // vtarget½
+private:
+    int n; // 
+    vector<int> landmarks; // ر
+    vector<int> from; // from[i * n + v]Ϊiر굽vľ
+    vector<int> to; // to[i * n + v]Ϊviرľ
+};
+
+/*
+ * õر½ƺA*ԵѯѰdis + ½򣬵targetʱֹͣ
+ * ½ÿβѯжÿֻһΣ״̬ô֣ÿβѯ㡣һֻһ߳ʹá
+ */
+class AltSearch {
+public:
+    AltSearch(const CsrGraph &G, const Landmarks &landmarks);
+    // sourcetarget0ʼ̾룬ɴʱINFpathΪNULLʱ·
+    int query(int source, int target, vector<int>* path = NULL);
+    int settledCount() const { return settledCnt; }; // һβѯȷĶ
+private:
+    const CsrGraph &G;
+    const Landmarks &landmarks;
+    int generation;
+    vector<int> stamp; // generationʱdispredboundЧ
+    vector<int> settledStamp; // generationʱѾȷ
+    vector<int> dis;
+    vector<int> pred;
+    vector<int> bound; // target½
+    DAryHeap<int> heap;
+    int settledCnt;
+};
+
+#endif //INC_0421_ALTSEARCH_H
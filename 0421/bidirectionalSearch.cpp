@@ -0,0 +1,69 @@
+#include "bidirectionalSearch.h"
+#include "shortestPath.h"
+#include <algorithm>
+
+BidirectionalSearch::BidirectionalSearch(const CsrGraph &G, const CsrGraph &reverse)
+        : generation(0), heap{DAryHeap<int>(G.vertexCount()), DAryHeap<int>(G.vertexCount())}, settledCnt(0) {
+    graph[0] = &G;
+    graph[1] = &reverse;
+    for(int side = 0; side < 2; side++) {
+        stamp[side].assign(G.vertexCount(), 0);
+        settledStamp[side].assign(G.vertexCount(), 0);
+        dis[side].resize(G.vertexCount());
+        pred[side].resize(G.vertexCount());
+    }
+}
+
+int BidirectionalSearch::query(int source, int target, vector<int>* path) {
+    generation++;
+    settledCnt = 0;
+    int ends[2] = {source, target};
+    for(int side = 0; side < 2; side++) {
+        heap[side].clear();
+        stamp[side][ends[side]] = generation;
+        dis[side][ends[side]] = 0;
+        pred[side][ends[side]] = -1;
+        heap[side].push(ends[side], 0);
+    }
+    int mu = source == target ? 0 : INF; // ֪·
+    int meet = source == target ? source : -1; // ·Ķ
+    while (!heap[0].empty() && !heap[1].empty()) {
+        if (WeightTraits<int>::add(heap[0].topKey(), heap[1].topKey()) >= mu)
+            break;
+        int side = heap[0].topKey() <= heap[1].topKey() ? 0 : 1;
+        int other = 1 - side;
+        const CsrGraph &G = *graph[side];
+        int d = heap[side].topKey();
+        int v = heap[side].pop();
+        settledStamp[side][v] = generation;
+        settledCnt++;
+        for(int e = G.begin(v); e < G.end(v); e++) {
+            int u = G.head(e);
+            if (settledStamp[side][u] == generation)
+                continue;
+            int nd = WeightTraits<int>::add(d, G.cost(e));
+            if (stamp[side][u] != generation || nd < dis[side][u]) {
+                stamp[side][u] = generation;
+                dis[side][u] = nd;
+                pred[side][u] = v;
+                heap[side].pushOrDecrease(u, nd);
+            }
+            if (stamp[other][u] == generation && WeightTraits<int>::add(dis[side][u], dis[other][u]) < mu) {
+                mu = WeightTraits<int>::add(dis[side][u], dis[other][u]);
+                meet = u;
+            }
+        }
+    }
+    if (meet < 0)
+        return INF;
+    if (path != NULL) {
+        // ǰmeet߻sourceǰmeetߵtarget
+        path->clear();
+        for(int v = meet; v >= 0; v = pred[0][v])
+            path->push_back(v);
+        reverse(path->begin(), path->end());
+        for(int v = pred[1][meet]; v >= 0; v = pred[1][v])
+            path->push_back(v);
+    }
+    return mu;
+}
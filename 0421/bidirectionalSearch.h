@@ -0,0 +1,32 @@
+#ifndef INC_0421_BIDIRECTIONALSEARCH_H
+#define INC_0421_BIDIRECTIONALSEARCH_H
+
+#include <vector>
+#include "csrGraph.h"
+#include "dAryHeap.h"
+
+using namespace std;
+
+/*
+ * ˫DijkstraGϡյڷͼͬʱÿչѶСһߡ
+ * ɳڵԷѾĶʱ߾֮͸¦̣Ѷ֮ͲСڦʱ̾̾룬ֹͣ
+ * ҪԤ״̬ô֣ÿβѯ㡣һֻһ߳ʹá
+ */
+class BidirectionalSearch {
+public:
+    BidirectionalSearch(const CsrGraph &G, const CsrGraph &reverse); // reverseΪG.reversed()
+    // sourcetarget0ʼ̾룬ɴʱINFpathΪNULLʱ·
+    int query(int source, int target, vector<int>* path = NULL);
+    int settledCount() const { return settledCnt; }; // һβѯȷĶ֮ͣ
+private:
+    const CsrGraph* graph[2]; // 0Ϊ1Ϊ
+    int generation;
+    vector<int> stamp[2]; // generationʱdispredЧ
+    vector<int> settledStamp[2]; // generationʱѾȷ
+    vector<int> dis[2];
+    vector<int> pred[2];
+    DAryHeap<int> heap[2];
+    int settledCnt;
+};
+
+#endif //INC_0421_BIDIRECTIONALSEARCH_H
@@ -0,0 +1,133 @@
+#ifndef INC_0421_BUCKETQUEUE_H
+#define INC_0421_BUCKETQUEUE_H
+
+#include <vector>
+
+using namespace std;
+
+/*
+ * DialͰУӿDAryHeapͬkeyΪǸֻDijkstraĳϣ
+ * keyҶеkeyǰСkey + maxWeightmaxWeight + 1Ͱѭʹþ͹ˡ
+ * ÿͰǶ˫pushdecreaseO(1)popʱӵǰkeyҷǿյͰ
+ * keyͬʱȳDAryHeapĳ˳ͬͬ
+ */
+template<typename Key>
+class BucketQueue {
+public:
+    BucketQueue() : current(0), count(0) {};
+    void reset(int n, Key maxWeight); // ŷΧΪ0..n-1ȨmaxWeight
+    bool empty() const { return count == 0; };
+    int size() const { return count; };
+    bool contains(int v) const { return queued[v]; };
+    Key topKey() const { seek(); return current; }; // Сkey
+    int top() const { seek(); return head[bucketOf(current)]; }; // keyСһ
+    void push(int v, Key key); // 벻ڶеĶ
+    void decreaseKey(int v, Key key); // ѶжkeyСkey
+    bool pushOrDecrease(int v, Key key); // ڶʱ룬ڶkeyСʱСǷб仯
+    int pop(); // keyСһ
+    void clear(); // նУѿʱͰ
+private:
+    vector<int> head; // ÿͰĵһ㣬-1ʾ
+    vector<int> next, prev; // Ͱеһһ
+    vector<Key> keys; // жkey
+    vector<char> queued; // Ƿڶ
+    mutable Key current; // ڶСkey
+    int count; // еĶ
+    size_t bucketOf(Key key) const { return (size_t)key % head.size(); };
+    void seek() const; // currentƵСkey
+    void link(int v); // vŽkeys[v]ӦͰ
+    void unlink(int v); // vڵͰȡ
+};
+
+template<typename Key>
+void BucketQueue<Key>::reset(int n, Key maxWeight) {
+    head.assign((size_t)maxWeight + 1, -1);
+    next.assign(n, -1);
+    prev.assign(n, -1);
+    keys.assign(n, 0);
+    queued.assign(n, 0);
+    current = 0;
+    count = 0;
+}
+
+template<typename Key>
+void BucketQueue<Key>::seek() const {
+    while (head[bucketOf(current)] < 0)
+        current++;
+}
+
+template<typename Key>
+void BucketQueue<Key>::link(int v) {
+    size_t b = bucketOf(keys[v]);
+    prev[v] = -1;
+    next[v] = head[b];
+    if (head[b] >= 0)
+        prev[head[b]] = v;
+    head[b] = v;
+}
+
+template<typename Key>
+void BucketQueue<Key>::unlink(int v) {
+    if (prev[v] >= 0)
+        next[prev[v]] = next[v];
+    else
+        head[bucketOf(keys[v])] = next[v];
+    if (next[v] >= 0)
+        prev[next[v]] = prev[v];
+}
+
+template<typename Key>
+void BucketQueue<Key>::push(int v, Key key) {
+    if (count == 0 || key < current)
+        current = key;
+    keys[v] = key;
+    queued[v] = 1;
+    link(v);
+    count++;
+}
+
+template<typename Key>
+void BucketQueue<Key>::decreaseKey(int v, Key key) {
+    unlink(v);
+    keys[v] = key;
+    link(v);
+    if (key < current)
+        current = key;
+}
+
+template<typename Key>
+bool BucketQueue<Key>::pushOrDecrease(int v, Key key) {
+    if (!queued[v]) {
+        push(v, key);
+        return true;
+    }
+    if (key < keys[v]) {
+        decreaseKey(v, key);
+        return true;
+    }
+    return false;
+}
+
+template<typename Key>
+int BucketQueue<Key>::pop() {
+    seek();
+    int v = head[bucketOf(current)];
+    unlink(v);
+    queued[v] = 0;
+    count--;
+    return v;
+}
+
+template<typename Key>
+void BucketQueue<Key>::clear() {
+    for(size_t b = 0; count > 0 && b < head.size(); b++) {
+        for(int v = head[b]; v >= 0; v = next[v]) {
+            queued[v] = 0;
+            count--;
+        }
+        head[b] = -1;
+    }
+    current = 0;
+}
+
+#endif //INC_0421_BUCKETQUEUE_H
@@ -0,0 +1,415 @@
+#include "contractionHierarchy.h"
+#include "shortestPath.h"
+#include <cstdio>
+#include <climits>
+#include <queue>
+#include <algorithm>
+
+// ֤ȷĶʱΪûм֤·ֻӽݾȼʱýС
+static const int WITNESS_LIMIT = 1000;
+static const int SIMULATE_LIMIT = 50;
+static const char MAGIC[4] = {'C', 'H', '0', '2'}; // ļʶ
+
+// ͼFNV-1aϣμÿoffsetÿߵյ㡢Ȩֵ
+static uint64_t graphHash(const CsrGraph &G) {
+    uint64_t hash = 14695981039346656037ULL;
+    auto mix = [&](int value) {
+        for(int k = 0; k < 4; k++) {
+            hash ^= (value >> (8 * k)) & 0xff;
+            hash *= 1099511628211ULL;
+        }
+    };
+    for(int v = 0; v < G.vertexCount(); v++) {
+        mix(G.begin(v));
+        for(int e = G.begin(v); e < G.end(v); e++) {
+            mix(G.head(e));
+            mix(G.cost(e));
+        }
+    }
+    mix(G.edgeCount());
+    return hash;
+}
+
+/* еĶ̬ͼͼ֤ */
+class Contractor {
+public:
+    Contractor(const CsrGraph &G);
+    int priority(int v); // 2 * ߲ + ھ + 
+    void contract(int v, vector<ChArc> &upArcs, vector<ChArc> &downArcs); // vvб
+    int shortcutCnt; // ѼӵĽݾ
+private:
+    int n;
+    vector<vector<ChArc>> out, in; // δ֮ĳߺߣintoΪ㣩
+    vector<int> deletedNeighbors; // ھ
+    vector<int> level; // ھӸһ㣬ͼоչ
+    vector<int> dis, stamp; // ֤ľ룬stampgenerationʱЧ
+    int generation;
+    DAryHeap<int> heap;
+    static void addArc(vector<ChArc> &arcs, int to, int weight, int middle); // ӱߣʱ϶̵
+    // sourceskip벻limitȷsettleLimit
+    void witnessSearch(int source, int skip, int limit, int settleLimit);
+    int witnessDistance(int v) const { return stamp[v] == generation ? dis[v] : INT_MAX; };
+    int shortcuts(int v, bool add); // vҪĽݾaddΪtrueʱ
+};
+
+Contractor::Contractor(const CsrGraph &G)
+        : shortcutCnt(0), n(G.vertexCount()), out(n), in(n), deletedNeighbors(n, 0), level(n, 0), dis(n, 0), stamp(n, 0),
+          generation(0), heap(n) {
+    for(int v = 0; v < n; v++) {
+        for(int e = G.begin(v); e < G.end(v); e++) {
+            if (G.head(e) == v)
+                continue;
+            addArc(out[v], G.head(e), G.cost(e), -1);
+            addArc(in[G.head(e)], v, G.cost(e), -1);
+        }
+    }
+}
+
+void Contractor::addArc(vector<ChArc> &arcs, int to, int weight, int middle) {
+    for(int i = 0; i < arcs.size(); i++) {
+        if (arcs[i].to == to) {
+            if (weight < arcs[i].weight) {
+                arcs[i].weight = weight;
+                arcs[i].middle = middle;
+            }
+            return;
+        }
+    }
+    ChArc arc;
+    arc.to = to;
+    arc.weight = weight;
+    arc.middle = middle;
+    arcs.push_back(arc);
+}
+
+void Contractor::witnessSearch(int source, int skip, int limit, int settleLimit) {
+    generation++;
+    heap.clear();
+    dis[source] = 0;
+    stamp[source] = generation;
+    heap.push(source, 0);
+    int settled = 0;
+    while (!heap.empty() && heap.topKey() <= limit && settled < settleLimit) {
+        int d = heap.topKey();
+        int v = heap.pop();
+        settled++;
+        for(int i = 0; i < out[v].size(); i++) {
+            int u = out[v][i].to;
+            if (u == skip)
+                continue;
+            int nd = WeightTraits<int>::add(d, out[v][i].weight);
+            if (nd <= limit && (stamp[u] != generation || nd < dis[u])) {
+                stamp[u] = generation;
+                dis[u] = nd;
+                heap.pushOrDecrease(u, nd);
+            }
+        }
+    }
+}
+
+int Contractor::shortcuts(int v, bool add) {
+    int cnt = 0;
+    for(int i = 0; i < in[v].size(); i++) {
+        int u = in[v][i].to;
+        int limit = -1; // v·-1ʾuvûгߣȨֵΪ00ʾû
+        for(int j = 0; j < out[v].size(); j++) {
+            if (out[v][j].to != u)
+                limit = max(limit, WeightTraits<int>::add(in[v][i].weight, out[v][j].weight));
+        }
+        if (limit < 0)
+            continue;
+        witnessSearch(u, v, limit, add ? WITNESS_LIMIT : SIMULATE_LIMIT);
+        for(int j = 0; j < out[v].size(); j++) {
+            int w = out[v][j].to;
+            int weight = WeightTraits<int>::add(in[v][i].weight, out[v][j].weight);
+            if (w == u || witnessDistance(w) <= weight)
+                continue;
+            cnt++;
+            if (add) {
+                addArc(out[u], w, weight, v);
+                addArc(in[w], u, weight, v);
+            }
+        }
+    }
+    return cnt;
+}
+
+int Contractor::priority(int v) {
+    int edgeDifference = shortcuts(v, false) - (int)(in[v].size() + out[v].size());
+    return 2 * edgeDifference + deletedNeighbors[v] + level[v];
+}
+
+void Contractor::contract(int v, vector<ChArc> &upArcs, vector<ChArc> &downArcs) {
+    shortcutCnt += shortcuts(v, true);
+    // vھӶûvߣЩ߾vб
+    upArcs.swap(out[v]);
+    downArcs.swap(in[v]);
+    // ھӵı߱ɾȥv
+    for(int i = 0; i < downArcs.size(); i++) {
+        vector<ChArc> &arcs = out[downArcs[i].to];
+        for(int k = 0; k < arcs.size(); k++) {
+            if (arcs[k].to == v) {
+                arcs[k] = arcs.back();
+                arcs.pop_back();
+                break;
+            }
+        }
+        deletedNeighbors[downArcs[i].to]++;
+        level[downArcs[i].to] = max(level[downArcs[i].to], level[v] + 1);
+    }
+    for(int i = 0; i < upArcs.size(); i++) {
+        vector<ChArc> &arcs = in[upArcs[i].to];
+        for(int k = 0; k < arcs.size(); k++) {
+            if (arcs[k].to == v) {
+                arcs[k] = arcs.back();
+                arcs.pop_back();
+                break;
+            }
+        }
+        deletedNeighbors[upArcs[i].to]++;
+        level[upArcs[i].to] = max(level[upArcs[i].to], level[v] + 1);
+    }
+    vector<ChArc>().swap(out[v]);
+    vector<ChArc>().swap(in[v]);
+}
+
+void ContractionHierarchy::build(const CsrGraph &G) {
+    n = G.vertexCount();
+    sourceEdgeCnt = G.edgeCount();
+    sourceHash = graphHash(G);
+    Contractor contractor(G);
+    vector<vector<ChArc>> upArcs(n), downArcs(n);
+
+    // ȼСȡʱ¼㣬ҲСʱŻȥԸ£
+    typedef pair<int, int> Item;
+    priority_queue<Item, vector<Item>, greater<Item>> order;
+    for(int v = 0; v < n; v++)
+        order.push(Item(contractor.priority(v), v));
+    rank.assign(n, -1);
+    int next = 0;
+    while (!order.empty()) {
+        int v = order.top().second;
+        order.pop();
+        int p = contractor.priority(v);
+        if (!order.empty() && p > order.top().first) {
+            order.push(Item(p, v));
+            continue;
+        }
+        rank[v] = next++;
+        contractor.contract(v, upArcs[v], downArcs[v]);
+    }
+    shortcutCnt = contractor.shortcutCnt;
+
+    // תCSR
+    upOffset.assign(n + 1, 0);
+    downOffset.assign(n + 1, 0);
+    up.clear();
+    down.clear();
+    for(int v = 0; v < n; v++) {
+        up.insert(up.end(), upArcs[v].begin(), upArcs[v].end());
+        down.insert(down.end(), downArcs[v].begin(), downArcs[v].end());
+        upOffset[v + 1] = up.size();
+        downOffset[v + 1] = down.size();
+    }
+}
+
+bool ContractionHierarchy::save(string filename) const {
+    FILE* fp = fopen(filename.c_str(), "wb");
+    if (fp == NULL)
+        return false;
+    int header[5] = {n, sourceEdgeCnt, shortcutCnt, (int)up.size(), (int)down.size()};
+    fwrite(MAGIC, 1, sizeof(MAGIC), fp);
+    fwrite(header, sizeof(int), 5, fp);
+    fwrite(&sourceHash, sizeof(sourceHash), 1, fp);
+    fwrite(rank.data(), sizeof(int), n, fp);
+    fwrite(upOffset.data(), sizeof(int), n + 1, fp);
+    fwrite(up.data(), sizeof(ChArc), up.size(), fp);
+    fwrite(downOffset.data(), sizeof(int), n + 1, fp);
+    fwrite(down.data(), sizeof(ChArc), down.size(), fp);
+    bool ok = !ferror(fp);
+    fclose(fp);
+    return ok;
+}
+
+bool ContractionHierarchy::load(string filename, const CsrGraph &G) {
+    FILE* fp = fopen(filename.c_str(), "rb");
+    if (fp == NULL)
+        return false;
+    fseek(fp, 0, SEEK_END);
+    long fileSize = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    char magic[4];
+    int header[5];
+    bool ok = fread(magic, 1, sizeof(magic), fp) == sizeof(magic) && equal(magic, magic + 4, MAGIC) &&
+              fread(header, sizeof(int), 5, fp) == 5 && header[0] >= 0 && header[3] >= 0 && header[4] >= 0 &&
+              fread(&sourceHash, sizeof(sourceHash), 1, fp) == 1;
+    if (ok) {
+        n = header[0];
+        sourceEdgeCnt = header[1];
+        shortcutCnt = header[2];
+        // ռ֮ǰȺ˶Թģ͹ϣֵҪӦGļСҪͷ鳤һ
+        uint64_t expectedSize = sizeof(magic) + sizeof(header) + sizeof(sourceHash) +
+                                sizeof(int) * ((uint64_t)n + 2 * ((uint64_t)n + 1)) +
+                                sizeof(ChArc) * ((uint64_t)header[3] + header[4]);
+        ok = matches(G) && fileSize >= 0 && (uint64_t)fileSize == expectedSize;
+    }
+    if (ok) {
+        rank.resize(n);
+        upOffset.resize(n + 1);
+        up.resize(header[3]);
+        downOffset.resize(n + 1);
+        down.resize(header[4]);
+        ok = fread(rank.data(), sizeof(int), n, fp) == n &&
+             fread(upOffset.data(), sizeof(int), n + 1, fp) == n + 1 &&
+             fread(up.data(), sizeof(ChArc), up.size(), fp) == up.size() &&
+             fread(downOffset.data(), sizeof(int), n + 1, fp) == n + 1 &&
+             fread(down.data(), sizeof(ChArc), down.size(), fp) == down.size() &&
+             valid();
+    }
+    fclose(fp);
+    return ok;
+}
+
+bool ContractionHierarchy::matches(const CsrGraph &G) const {
+    return n == G.vertexCount() && sourceEdgeCnt == G.edgeCount() && sourceHash == graphHash(G);
+}
+
+// 0..n-1Уoffset0ʼбͨߵĶ㣬ݾmiddle˶ͣչʱһ
+bool ContractionHierarchy::valid() const {
+    vector<bool> used(n, false);
+    for(int v = 0; v < n; v++) {
+        if (rank[v] < 0 || rank[v] >= n || used[rank[v]])
+            return false;
+        used[rank[v]] = true;
+    }
+    const vector<int>* offsets[2] = {&upOffset, &downOffset};
+    const vector<ChArc>* arcLists[2] = {&up, &down};
+    for(int side = 0; side < 2; side++) {
+        const vector<int> &offset = *offsets[side];
+        const vector<ChArc> &arcs = *arcLists[side];
+        if (offset[0] != 0 || offset[n] != arcs.size())
+            return false;
+        for(int v = 0; v < n; v++) {
+            if (offset[v + 1] < offset[v] || offset[v + 1] > arcs.size())
+                return false;
+            for(int a = offset[v]; a < offset[v + 1]; a++) {
+                const ChArc &arc = arcs[a];
+                if (arc.to < 0 || arc.to >= n || rank[arc.to] <= rank[v] || arc.weight < 0 || arc.middle < -1 ||
+                    arc.middle >= n || (arc.middle >= 0 && rank[arc.middle] >= rank[v]))
+                    return false;
+            }
+        }
+    }
+    return true;
+}
+
+const ChArc* ContractionHierarchy::findUp(int v, int to) const {
+    for(int a = upOffset[v]; a < upOffset[v + 1]; a++) {
+        if (up[a].to == to)
+            return &up[a];
+    }
+    return NULL;
+}
+
+const ChArc* ContractionHierarchy::findDown(int v, int from) const {
+    for(int a = downOffset[v]; a < downOffset[v + 1]; a++) {
+        if (down[a].to == from)
+            return &down[a];
+    }
+    return NULL;
+}
+
+bool ContractionHierarchy::unpack(int from, int to, int middle, vector<int> &path) const {
+    if (middle < 0) {
+        path.push_back(to);
+        return true;
+    }
+    // ݾfrom->tofrom->middlemiddle->toɣmiddle˶ͣ߶middle
+    const ChArc* first = findDown(middle, from);
+    const ChArc* second = findUp(middle, to);
+    return first != NULL && second != NULL && unpack(from, middle, first->middle, path) &&
+           unpack(middle, to, second->middle, path);
+}
+
+ChSearch::ChSearch(const ContractionHierarchy &ch)
+        : ch(ch), generation(0), forwardStamp(ch.n, 0), backwardStamp(ch.n, 0), forwardDis(ch.n), backwardDis(ch.n),
+          forwardPred(ch.n), backwardPred(ch.n), forwardHeap(ch.n), backwardHeap(ch.n) {}
+
+int ChSearch::query(int source, int target, vector<int>* path) {
+    generation++;
+    forwardHeap.clear();
+    backwardHeap.clear();
+    forwardStamp[source] = generation;
+    forwardDis[source] = 0;
+    forwardPred[source] = -1;
+    forwardHeap.push(source, 0);
+    backwardStamp[target] = generation;
+    backwardDis[target] = 0;
+    backwardPred[target] = -1;
+    backwardHeap.push(target, 0);
+    int best = INT_MAX, meet = -1;
+    while (true) {
+        bool forward = !forwardHeap.empty() && forwardHeap.topKey() < best;
+        bool backward = !backwardHeap.empty() && backwardHeap.topKey() < best;
+        if (!forward && !backward)
+            break;
+        if (forward && backward)
+            forward = forwardHeap.topKey() <= backwardHeap.topKey();
+        // Ĵֻͬʹõıߺͻͬ
+        DAryHeap<int> &heap = forward ? forwardHeap : backwardHeap;
+        vector<int> &stamp = forward ? forwardStamp : backwardStamp;
+        vector<int> &dis = forward ? forwardDis : backwardDis;
+        vector<int> &pred = forward ? forwardPred : backwardPred;
+        const vector<int> &otherStamp = forward ? backwardStamp : forwardStamp;
+        const vector<int> &otherDis = forward ? backwardDis : forwardDis;
+        const vector<int> &offset = forward ? ch.upOffset : ch.downOffset;
+        const vector<ChArc> &arcs = forward ? ch.up : ch.down;
+        const vector<int> &stallOffset = forward ? ch.downOffset : ch.upOffset;
+        const vector<ChArc> &stallArcs = forward ? ch.down : ch.up;
+        int d = heap.topKey();
+        int v = heap.pop();
+        if (otherStamp[v] == generation && WeightTraits<int>::add(d, otherDis[v]) < best) {
+            best = WeightTraits<int>::add(d, otherDis[v]);
+            meet = v;
+        }
+        // stall-on-demandܴߵѵﶥ̵ߵvʱv·ϣüչ
+        bool stalled = false;
+        for(int a = stallOffset[v]; a < stallOffset[v + 1] && !stalled; a++) {
+            int u = stallArcs[a].to;
+            stalled = stamp[u] == generation && WeightTraits<int>::add(dis[u], stallArcs[a].weight) < d;
+        }
+        if (stalled)
+            continue;
+        for(int a = offset[v]; a < offset[v + 1]; a++) {
+            int u = arcs[a].to;
+            int nd = WeightTraits<int>::add(d, arcs[a].weight);
+            if (stamp[u] != generation || nd < dis[u]) {
+                stamp[u] = generation;
+                dis[u] = nd;
+                pred[u] = v;
+                heap.pushOrDecrease(u, nd);
+            }
+        }
+    }
+    if (meet < 0)
+        return INF;
+    if (path != NULL) {
+        // 򲿷ִmeetǰ߻sourceٷ򲿷ִmeetǰߵtargetÿչԭͼ·
+        vector<int> chain;
+        for(int v = meet; v >= 0; v = forwardPred[v])
+            chain.push_back(v);
+        reverse(chain.begin(), chain.end());
+        for(int v = backwardPred[meet]; v >= 0; v = backwardPred[v])
+            chain.push_back(v);
+        path->assign(1, source);
+        for(int i = 0; i + 1 < chain.size(); i++) {
+            const ChArc* arc = ch.rank[chain[i]] < ch.rank[chain[i + 1]] ? ch.findUp(chain[i], chain[i + 1])
+                                                                   : ch.findDown(chain[i + 1], chain[i]);
+            if (arc == NULL || !ch.unpack(chain[i], chain[i + 1], arc->middle, *path)) {
+                path->clear(); // β·
+                break;
+            }
+        }
+    }
+    return best;
+}
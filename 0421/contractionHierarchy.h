@@ -0,0 +1,73 @@
+#ifndef INC_0421_CONTRACTIONHIERARCHY_H
+#define INC_0421_CONTRACTIONHIERARCHY_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "csrGraph.h"
+#include "dAryHeap.h"
+
+using namespace std;
+
+/* еһߣmiddleΪݾĶ㣬ԭͼıΪ-1 */
+struct ChArc {
+    int to;
+    int weight;
+    int middle;
+};
+
+/*
+ * ΣContraction HierarchiesԤʱȼ2 * ߲ + ھ + 㣬
+ * vʱÿھuھw޵ļ֤ҲvҲu->v->w·ʱӽݾu->w
+ * ÿֻͨߵĶıߣupΪvıߣdownΪvıߣtoΪ㣩
+ * ԤֻѯChSearch
+ */
+class ContractionHierarchy {
+public:
+    ContractionHierarchy() : n(0), sourceEdgeCnt(0), sourceHash(0), shortcutCnt(0) {};
+    void build(const CsrGraph &G); // Ԥ
+    bool save(string filename) const; // 浽ļ
+    bool load(string filename, const CsrGraph &G); // saveдGΣļӦGʱfalse
+    bool matches(const CsrGraph &G) const; // ǷGԤõȽϹģͼĹϣֵ
+    int vertexCount() const { return n; };
+    int shortcutCount() const { return shortcutCnt; }; // ݾ
+private:
+    friend class ChSearch;
+    int n; // 
+    int sourceEdgeCnt; // ԭͼıļǷӦͼ
+    uint64_t sourceHash; // ԭͼoffsetյȨֵĹϣֵͬȨֵͬʱҲܷ
+    int shortcutCnt; // ݾ
+    vector<int> rank; // ˳
+    vector<int> upOffset; // vгΪup[upOffset[v]]up[upOffset[v + 1] - 1]
+    vector<ChArc> up;
+    vector<int> downOffset; // vΪdown[downOffset[v]]down[downOffset[v + 1] - 1]
+    vector<ChArc> down;
+
+    // ѱfrom->toչηfromĶ㣻Ҳɽݾıʱfalse
+    bool unpack(int from, int to, int middle, vector<int> &path) const;
+    bool valid() const; // ǷǢ
+    const ChArc* findUp(int v, int to) const; // vгеtoı
+    const ChArc* findDown(int v, int from) const; // vдfromı
+};
+
+/*
+ * ϵĵԵѯupյdownͬʱDijkstrastall-on-demand
+ * ߵС붼С֪·ʱֹͣѯֻ
+ * ̸߳һChSearchͬһContractionHierarchyһֻһ߳ʹá
+ */
+class ChSearch {
+public:
+    explicit ChSearch(const ContractionHierarchy &ch); // chChSearchʹڼ䲻޸
+    // sourcetarget0ʼ̾룬ɴʱINFpathΪNULLʱչݾõԭͼе·
+    int query(int source, int target, vector<int>* path = NULL);
+private:
+    const ContractionHierarchy &ch;
+    // disֻstampgenerationʱЧÿ
+    int generation;
+    vector<int> forwardStamp, backwardStamp;
+    vector<int> forwardDis, backwardDis;
+    vector<int> forwardPred, backwardPred; // еǰ
+    DAryHeap<int> forwardHeap, backwardHeap;
+};
+
+#endif //INC_0421_CONTRACTIONHIERARCHY_H
@@ -0,0 +1,140 @@
+#include "csrGraph.h"
+#include <fstream>
+#include <cctype>
+#include <cstdint>
+
+template<typename W>
+bool BasicCsrGraph<W>::load(string filename) {
+    ifstream inFile;
+    inFile.open(filename, ios_base::in);
+    if (!inFile.is_open())
+        return false;
+    int vertexCnt = 0;
+    if (!(inFile >> vertexCnt) || vertexCnt < 0)
+        return false;
+
+    // 
+    vector<string> names(vertexCnt);
+    inFile >> ws;
+    if (inFile.peek() != EOF && !isdigit(inFile.peek())) {
+        for(int i = 0; i < vertexCnt; i++) {
+            if (!(inFile >> names[i]))
+                return false;
+        }
+    } else {
+        for(int i = 0; i < vertexCnt; i++)
+            names[i] = to_string(i + 1);
+    }
+    streampos edgeStart = inFile.tellg(); // ߴ￪ʼ
+
+    // һ飺
+    vector<int> count(vertexCnt + 1, 0);
+    int u, v;
+    W w;
+    while (inFile >> u >> v >> ws) {
+        // ȨΪ޷Ͷ"-2"ʱƻسɺܴڶ֮ǰ
+        if (inFile.peek() == '-' || !(inFile >> w))
+            return false;
+        if (u <= 0 || u > vertexCnt || v <= 0 || v > vertexCnt)
+            return false;
+        count[u]++;
+    }
+    if (!inFile.eof())
+        return false;
+    n = vertexCnt;
+    labels.swap(names);
+    indexLabels();
+    offset.assign(n + 1, 0);
+    for(int i = 0; i < n; i++)
+        offset[i + 1] = offset[i] + count[i + 1];
+    target.resize(offset[n]);
+    weight.resize(offset[n]);
+
+    // ڶ飺offsetߣͬһĳ߱ļе˳
+    inFile.clear();
+    inFile.seekg(edgeStart);
+    vector<int> next(offset.begin(), offset.end() - 1);
+    while (inFile >> u >> v >> w) {
+        int e = next[u - 1]++;
+        target[e] = v - 1;
+        weight[e] = w;
+    }
+    inFile.close();
+    return true;
+}
+
+template<typename W>
+void BasicCsrGraph<W>::build(int vertexCnt, const vector<int> &from, const vector<int> &to, const vector<W> &cost) {
+    n = vertexCnt;
+    labels.resize(n);
+    for(int i = 0; i < n; i++)
+        labels[i] = to_string(i + 1);
+    indexLabels();
+    offset.assign(n + 1, 0);
+    for(int i = 0; i < from.size(); i++)
+        offset[from[i] + 1]++;
+    for(int i = 0; i < n; i++)
+        offset[i + 1] += offset[i];
+    target.resize(from.size());
+    weight.resize(from.size());
+    vector<int> next(offset.begin(), offset.end() - 1);
+    for(int i = 0; i < from.size(); i++) {
+        int e = next[from[i]]++;
+        target[e] = to[i];
+        weight[e] = cost[i];
+    }
+}
+
+template<typename W>
+int BasicCsrGraph<W>::find(const string &name) const {
+    unordered_map<string, int>::const_iterator it = labelIndex.find(name);
+    return it == labelIndex.end() ? -1 : it->second;
+}
+
+template<typename W>
+void BasicCsrGraph<W>::indexLabels() {
+    labelIndex.clear();
+    labelIndex.reserve(n);
+    for(int v = 0; v < n; v++)
+        labelIndex.insert(make_pair(labels[v], v));
+}
+
+template<typename W>
+BasicCsrGraph<W> BasicCsrGraph<W>::reversed() const {
+    BasicCsrGraph R;
+    R.n = n;
+    R.labels = labels;
+    R.labelIndex = labelIndex;
+    R.offset.assign(n + 1, 0);
+    for(int e = 0; e < target.size(); e++)
+        R.offset[target[e] + 1]++;
+    for(int i = 0; i < n; i++)
+        R.offset[i + 1] += R.offset[i];
+    R.target.resize(target.size());
+    R.weight.resize(weight.size());
+    vector<int> next(R.offset.begin(), R.offset.end() - 1);
+    for(int v = 0; v < n; v++) {
+        for(int e = offset[v]; e < offset[v + 1]; e++) {
+            int r = next[target[e]]++;
+            R.target[r] = v;
+            R.weight[r] = weight[e];
+        }
+    }
+    return R;
+}
+
+template<typename W>
+W BasicCsrGraph<W>::maxCost() const {
+    W result = 0;
+    for(int e = 0; e < weight.size(); e++) {
+        if (result < weight[e])
+            result = weight[e];
+    }
+    return result;
+}
+
+template class BasicCsrGraph<int>;
+template class BasicCsrGraph<uint32_t>;
+template class BasicCsrGraph<uint64_t>;
+template class BasicCsrGraph<float>;
+template class BasicCsrGraph<double>;
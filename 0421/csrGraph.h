@@ -0,0 +1,52 @@
+#ifndef INC_0421_CSRGRAPH_H
+#define INC_0421_CSRGRAPH_H
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+using namespace std;
+
+/*
+ * ѹϡУCSR洢ͼڴO(n + m)ڲ0ʼţ
+ * vĳΪoffset[v]offset[v + 1] - 1ߣյȨֱֵtargetweightС
+ * ȨֵWintuint32_tuint64_tfloatdoublecsrGraph.cppʽʵ
+ */
+template<typename W>
+class BasicCsrGraph {
+public:
+    BasicCsrGraph() : n(0), offset(1, 0) {};
+    /*
+     * ļ룺һΪnڶпnƣһַ֣ûʱñΪƣ
+     * ֮ÿ"u v w"ʾһuvȨֵΪwıߣuv1ʼԽȨֵΪʱfalse
+     * һֻÿĳȣoffsetڶ鰴offsetѱֱλϣҪʱı߱
+     */
+    bool load(string filename);
+    // ɱ߱ͼiߴfrom[i]to[i]0ʼͬñΪ
+    void build(int vertexCnt, const vector<int> &from, const vector<int> &to, const vector<W> &cost);
+    BasicCsrGraph reversed() const; // б߷ͼͬ
+
+    int vertexCount() const { return n; }; // 
+    int edgeCount() const { return target.size(); }; // ߵ
+    int begin(int v) const { return offset[v]; }; // vĵһ
+    int end(int v) const { return offset[v + 1]; }; // vһߵһ
+    int head(int e) const { return target[e]; }; // eߵյ
+    W cost(int e) const { return weight[e]; }; // eߵȨֵ
+    W maxCost() const; // ıȨûбʱΪ0
+    const string &label(int v) const { return labels[v]; }; // v
+    int find(const string &name) const; // ΪnameĶ㣬ûʱ-1ϣO(1)
+
+private:
+    int n; // 
+    vector<int> offset; // ÿһߵλãΪn + 1
+    vector<int> target; // ÿߵյ
+    vector<W> weight; // ÿߵȨֵ
+    vector<string> labels; // 
+    unordered_map<string, int> labelIndex; // ƵظʱΪһ
+
+    void indexLabels(); // labelsؽlabelIndex
+};
+
+typedef BasicCsrGraph<int> CsrGraph;
+
+#endif //INC_0421_CSRGRAPH_H
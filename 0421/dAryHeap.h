@@ -0,0 +1,128 @@
+#ifndef INC_0421_DARYHEAP_H
+#define INC_0421_DARYHEAP_H
+
+#include <vector>
+
+using namespace std;
+
+/*
+ * DСѣԪΪ0..n-1(key, )keyͬʱСȳѡ
+ * position¼ÿڶе±֧꣬O(log_D n)decreaseKeyDȡ4ʱһĺͨͬһ
+ */
+template<typename Key, int D = 4>
+class DAryHeap {
+public:
+    explicit DAryHeap(int n) : position(n, -1) {}; // ŷΧΪ0..n-1
+    bool empty() const { return heap.empty(); };
+    int size() const { return heap.size(); };
+    bool contains(int v) const { return position[v] >= 0; };
+    Key topKey() const { return heap[0].key; }; // Ѷkey
+    int top() const { return heap[0].vertex; }; // ѶĶ
+    void push(int v, Key key); // 벻ڶеĶ
+    void decreaseKey(int v, Key key); // ѶжkeyСkey
+    bool pushOrDecrease(int v, Key key); // ڶʱ룬ڶkeyСʱСǷб仯
+    int pop(); // keyСĶ
+    void clear(); // նѣֻʶʣµĶ
+private:
+    struct Entry {
+        Key key;
+        int vertex;
+        bool operator<(const Entry &other) const {
+            return key < other.key || (!(other.key < key) && vertex < other.vertex);
+        };
+    };
+    vector<Entry> heap; // 
+    vector<int> position; // ڶе±꣬-1ʾڶ
+    void siftUp(int i); // ϵ
+    void siftDown(int i); // µ
+};
+
+template<typename Key, int D>
+void DAryHeap<Key, D>::siftUp(int i) {
+    Entry entry = heap[i];
+    while (i > 0) {
+        int parent = (i - 1) / D;
+        if (!(entry < heap[parent]))
+            break;
+        heap[i] = heap[parent];
+        position[heap[i].vertex] = i;
+        i = parent;
+    }
+    heap[i] = entry;
+    position[entry.vertex] = i;
+}
+
+template<typename Key, int D>
+void DAryHeap<Key, D>::siftDown(int i) {
+    Entry entry = heap[i];
+    int n = heap.size();
+    while (true) {
+        int first = i * D + 1;
+        if (first >= n)
+            break;
+        int best = first;
+        int last = first + D < n ? first + D : n;
+        for(int c = first + 1; c < last; c++) {
+            if (heap[c] < heap[best])
+                best = c;
+        }
+        if (!(heap[best] < entry))
+            break;
+        heap[i] = heap[best];
+        position[heap[i].vertex] = i;
+        i = best;
+    }
+    heap[i] = entry;
+    position[entry.vertex] = i;
+}
+
+template<typename Key, int D>
+void DAryHeap<Key, D>::push(int v, Key key) {
+    Entry entry;
+    entry.key = key;
+    entry.vertex = v;
+    heap.push_back(entry);
+    siftUp(heap.size() - 1);
+}
+
+template<typename Key, int D>
+void DAryHeap<Key, D>::decreaseKey(int v, Key key) {
+    int i = position[v];
+    heap[i].key = key;
+    siftUp(i);
+}
+
+template<typename Key, int D>
+bool DAryHeap<Key, D>::pushOrDecrease(int v, Key key) {
+    if (position[v] < 0) {
+        push(v, key);
+        return true;
+    }
+    if (key < heap[position[v]].key) {
+        decreaseKey(v, key);
+        return true;
+    }
+    return false;
+}
+
+template<typename Key, int D>
+int DAryHeap<Key, D>::pop() {
+    int v = heap[0].vertex;
+    position[v] = -1;
+    Entry last = heap.back();
+    heap.pop_back();
+    if (!heap.empty()) {
+        heap[0] = last;
+        siftDown(0);
+    }
+    return v;
+}
+
+template<typename Key, int D>
+void DAryHeap<Key, D>::clear() {
+    for(int i = 0; i < heap.size(); i++)
+        position[heap[i].vertex] = -1;
+    heap.clear();
+}
+
+#endif //INC_0421_DARYHEAP_H
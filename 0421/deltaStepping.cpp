@@ -0,0 +1,99 @@
+#include "deltaStepping.h"
+#include "shortestPath.h"
+#include "threadPool.h"
+#include <atomic>
+#include <memory>
+#include <algorithm>
+
+// ԭӵذtargetĳmin(target, value)Сʱtrue
+static bool atomicMin(atomic<int> &target, int value) {
+    int current = target.load(memory_order_relaxed);
+    while (value < current) {
+        if (target.compare_exchange_weak(current, value, memory_order_relaxed))
+            return true;
+    }
+    return false;
+}
+
+void deltaStepping(const CsrGraph &G, int source, int delta, int threads, vector<int> &dis) {
+    int n = G.vertexCount();
+    int maxWeight = max(G.maxCost(), 1);
+    if (delta <= 0)
+        delta = max(1, (int)((long long)maxWeight * n / max(G.edgeCount(), 1)));
+    unique_ptr<atomic<int>[]> distance(new atomic<int>[n]);
+    for(int v = 0; v < n; v++)
+        distance[v].store(INF, memory_order_relaxed);
+    distance[source].store(0, memory_order_relaxed);
+
+    ThreadPool pool(threads);
+    int parts = pool.size();
+    // iͰbuckets[i % bucketCnt]iͰʱδľ붼[i, i + maxWeight]ڣ
+    // ceil(maxWeight / ) + 1Ͱѭʹô͹ˣڴ޹
+    int bucketCnt = (int)(((long long)maxWeight + delta - 1) / delta) + 1;
+    vector<vector<int>> buckets(bucketCnt); // ͰпظѾߵĶ㣬ȡʱټ
+    buckets[0].push_back(source);
+    long long pending = 1; // ͰеԪظ
+    vector<vector<int>> updated(parts); // ÿ߳һоСĶ
+    vector<int> inFrontier(n, -1); // һνһֵfrontierȥ
+    vector<int> inSettled(n, -1); // һηŽĸͰsettledȥ
+    vector<int> frontier, settled;
+    int round = 0;
+
+    // ɳfrontierж߻رߣȻѾСĶ㰴¾ŽͰ
+    auto relax = [&](const vector<int> &vertices, bool light) {
+        pool.parallelFor(parts, [&](int part) {
+            vector<int> &out = updated[part];
+            int begin = (long long)vertices.size() * part / parts;
+            int end = (long long)vertices.size() * (part + 1) / parts;
+            for(int k = begin; k < end; k++) {
+                int v = vertices[k];
+                int base = distance[v].load(memory_order_relaxed);
+                for(int e = G.begin(v); e < G.end(v); e++) {
+                    int w = G.cost(e);
+                    if ((w <= delta) != light)
+                        continue;
+                    int u = G.head(e);
+                    if (atomicMin(distance[u], WeightTraits<int>::add(base, w)))
+                        out.push_back(u);
+                }
+            }
+        });
+        for(int part = 0; part < parts; part++) {
+            for(int k = 0; k < updated[part].size(); k++) {
+                int u = updated[part][k];
+                buckets[distance[u].load(memory_order_relaxed) / delta % bucketCnt].push_back(u);
+                pending++;
+            }
+            updated[part].clear();
+        }
+    };
+
+    for(int i = 0; pending > 0; i++) {
+        vector<int> &bucket = buckets[i % bucketCnt];
+        settled.clear();
+        while (!bucket.empty()) {
+            // ȡǰͰоȷʵͰĶ
+            frontier.clear();
+            for(int k = 0; k < bucket.size(); k++) {
+                int v = bucket[k];
+                if (distance[v].load(memory_order_relaxed) / delta == i && inFrontier[v] != round) {
+                    inFrontier[v] = round;
+                    frontier.push_back(v);
+                    if (inSettled[v] != i) {
+                        inSettled[v] = i;
+                        settled.push_back(v);
+                    }
+                }
+            }
+            pending -= bucket.size();
+            bucket.clear();
+            round++;
+            relax(frontier, true);
+        }
+        relax(settled, false);
+    }
+
+    dis.resize(n);
+    for(int v = 0; v < n; v++)
+        dis[v] = distance[v].load(memory_order_relaxed);
+}
@@ -0,0 +1,17 @@
+#ifndef INC_0421_DELTASTEPPING_H
+#define INC_0421_DELTASTEPPING_H
+
+#include <vector>
+#include "csrGraph.h"
+
+using namespace std;
+
+/*
+ * -steppingеԴ·Meyer & Sanders㰴dis / ŽͰС
+ * ԵǰͰɳߣȨֱֵͰ¶㣬ٲɳͰжرߡ
+ * ɳCASʵԭӵȡСֵ̰߳ѾСĶԼбÿһֽͳһŽͰ
+ * delta0ʱȡȨֵƽȣΪ1disDijkstraSearchͬɴΪINF
+ */
+void deltaStepping(const CsrGraph &G, int source, int delta, int threads, vector<int> &dis);
+
+#endif //INC_0421_DELTASTEPPING_H
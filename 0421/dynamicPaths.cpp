@@ -0,0 +1,147 @@
+#include "dynamicPaths.h"
+#include "shortestPath.h"
+#include <algorithm>
+
+DynamicShortestPaths::DynamicShortestPaths(const CsrGraph &G, int source)
+        : n(G.vertexCount()), source(source), out(G.vertexCount()), in(G.vertexCount()),
+          heap(G.vertexCount()), invalid(G.vertexCount(), 0) {
+    for(int v = 0; v < n; v++) {
+        for(int e = G.begin(v); e < G.end(v); e++) {
+            out[v].push_back({G.head(e), G.cost(e)});
+            in[G.head(e)].push_back({v, G.cost(e)});
+        }
+    }
+    DijkstraSearch search(G);
+    search.run(source);
+    dis = search.distances();
+    pred = search.predecessors();
+}
+
+int DynamicShortestPaths::findArc(const vector<DynamicArc> &arcs, int vertex, int weight) const {
+    for(int i = 0; i < arcs.size(); i++) {
+        if (arcs[i].vertex == vertex && (weight < 0 || arcs[i].weight == weight))
+            return i;
+    }
+    return -1;
+}
+
+int DynamicShortestPaths::setWeight(int u, int v, int weight) {
+    int i = findArc(out[u], v);
+    if (i < 0)
+        return -1;
+    int old = out[u][i].weight;
+    out[u][i].weight = weight;
+    in[v][findArc(in[v], u, old)].weight = weight;
+    if (weight < old)
+        return decreased(u, v, weight);
+    return weight > old ? increased(u, v) : 0;
+}
+
+int DynamicShortestPaths::insertEdge(int u, int v, int weight) {
+    out[u].push_back({v, weight});
+    in[v].push_back({u, weight});
+    return decreased(u, v, weight);
+}
+
+int DynamicShortestPaths::deleteEdge(int u, int v) {
+    int i = findArc(out[u], v);
+    if (i < 0)
+        return -1;
+    int j = findArc(in[v], u, out[u][i].weight);
+    out[u][i] = out[u].back();
+    out[u].pop_back();
+    in[v][j] = in[v].back();
+    in[v].pop_back();
+    return increased(u, v);
+}
+
+int DynamicShortestPaths::decreased(int u, int v, int weight) {
+    int nd = WeightTraits<int>::add(dis[u], weight); // dis[u]INF
+    if (nd >= dis[v])
+        return 0;
+    dis[v] = nd;
+    pred[v] = u;
+    heap.push(v, dis[v]);
+    return propagate();
+}
+
+int DynamicShortestPaths::propagate() {
+    int changed = 0;
+    while (!heap.empty()) {
+        int min = heap.topKey();
+        int x = heap.pop();
+        changed++;
+        for(int i = 0; i < out[x].size(); i++) {
+            int y = out[x][i].vertex;
+            int nd = WeightTraits<int>::add(min, out[x][i].weight);
+            if (nd < dis[y]) {
+                dis[y] = nd;
+                pred[y] = x;
+                heap.pushOrDecrease(y, dis[y]);
+            }
+        }
+    }
+    return changed;
+}
+
+int DynamicShortestPaths::increased(int u, int v) {
+    if (pred[v] != u || v == source)
+        return 0; // ߣ·
+    // ҳvеĶľ붼ܱ䳤
+    subtree.clear();
+    subtree.push_back(v);
+    invalid[v] = 1;
+    for(int k = 0; k < subtree.size(); k++) {
+        int x = subtree[k];
+        for(int i = 0; i < out[x].size(); i++) {
+            int y = out[x][i].vertex;
+            if (pred[y] == x && !invalid[y]) {
+                invalid[y] = 1;
+                subtree.push_back(y);
+            }
+        }
+    }
+    for(int k = 0; k < subtree.size(); k++) {
+        dis[subtree[k]] = INF;
+        pred[subtree[k]] = -1;
+    }
+    // ھӸʼ룬ľ벻Ӱ
+    for(int k = 0; k < subtree.size(); k++) {
+        int x = subtree[k];
+        for(int i = 0; i < in[x].size(); i++) {
+            int p = in[x][i].vertex;
+            int nd = WeightTraits<int>::add(dis[p], in[x][i].weight);
+            if (!invalid[p] && nd < dis[x]) {
+                dis[x] = nd;
+                pred[x] = p;
+            }
+        }
+        if (dis[x] < INF)
+            heap.push(x, dis[x]);
+    }
+    for(int k = 0; k < subtree.size(); k++)
+        invalid[subtree[k]] = 0;
+    propagate();
+    return subtree.size();
+}
+
+void DynamicShortestPaths::recompute(vector<int> &result) const {
+    result.assign(n, INF);
+    vector<bool> settled(n, false);
+    DAryHeap<int> queue(n);
+    result[source] = 0;
+    queue.push(source, 0);
+    while (!queue.empty()) {
+        int min = queue.topKey();
+        int x = queue.pop();
+        settled[x] = true;
+        for(int i = 0; i < out[x].size(); i++) {
+            int y = out[x][i].vertex;
+            int nd = WeightTraits<int>::add(min, out[x][i].weight);
+            if (!settled[y] && nd < result[y]) {
+                result[y] = nd;
+                queue.pushOrDecrease(y, result[y]);
+            }
+        }
+    }
+}
@@ -0,0 +1,55 @@
+#ifndef INC_0421_DYNAMICPATHS_H
+#define INC_0421_DYNAMICPATHS_H
+
+#include <vector>
+#include "csrGraph.h"
+#include "dAryHeap.h"
+
+using namespace std;
+
+/* ޸ͼеһߣ߱vertexΪյ㣬߱Ϊ㣩 */
+struct DynamicArc {
+    int vertex;
+    int weight;
+};
+
+/*
+ * Ȩ仯ͼϵĵԴ·ͼƳɳ߱߱CSRɾߣ޸ıߺֻ޸ӰĲ֣RamalingamCReps
+ *   ̻߱¼ӱߣֻյܱյ㿪ʼDijkstraֻչСĶ㣻
+ *   ߱䳤ɾߣ·ϵıʱʲôյеȫʧЧ
+ *   ʧЧûʧЧھӸʼ룬ֻʧЧ֮Dijkstra
+ * رʱ(u, v)޸Ļɾǳ߱еһuvıߡһֻһ߳ʹá
+ */
+class DynamicShortestPaths {
+public:
+    DynamicShortestPaths(const CsrGraph &G, int source); // ͼһ·
+    // ޸ķؾǰ仯Ķ
+    int setWeight(int u, int v, int weight); // ޸uvıߵȨֵûʱ-1
+    int insertEdge(int u, int v, int weight); // һuvı
+    int deleteEdge(int u, int v); // ɾuvıߣûʱ-1
+    int distance(int v) const { return dis[v]; }; // vľ룬ɴʱΪINF
+    int predecessor(int v) const { return pred[v]; }; // ·vǰһ㣬-1ʾû
+    const vector<int> &distances() const { return dis; };
+    void recompute(vector<int> &result) const; // ڵǰͼϴͷһ룬ȽϺУ
+    int vertexCount() const { return n; };
+    int outDegree(int v) const { return out[v].size(); };
+    const DynamicArc &outArc(int v, int i) const { return out[v][i]; }; // vĵi
+private:
+    int n; // 
+    int source; // Դ
+    vector<vector<DynamicArc>> out; // ߱
+    vector<vector<DynamicArc>> in; // ߱
+    vector<int> dis;
+    vector<int> pred;
+    DAryHeap<int> heap;
+    vector<char> invalid; // ߱䳤ʱʧЧĶ㣬޸
+    vector<int> subtree; // ʧЧĶ
+
+    // arcsеһvertexȨֵΪweightС0ʱޣıߣûʱ-1رʱ߱ҪȨֵҶӦ
+    int findArc(const vector<DynamicArc> &arcs, int vertex, int weight = -1) const;
+    int decreased(int u, int v, int weight); // uvȨֵΪweightĸ̵ı
+    int increased(int u, int v); // uvı߱䳤ɾ޸v
+    int propagate(); // ӶеĶ㿪ʼDijkstraֻչСĶ㣬ȷĶ
+};
+
+#endif //INC_0421_DYNAMICPATHS_H
@@ -0,0 +1,48 @@
+#include "graphGenerator.h"
+#include <random>
+
+// һ˫
+static void addBoth(int u, int v, int w, vector<int> &from, vector<int> &to, vector<int> &cost) {
+    from.push_back(u);
+    to.push_back(v);
+    cost.push_back(w);
+    from.push_back(v);
+    to.push_back(u);
+    cost.push_back(w);
+}
+
+CsrGraph gridGraph(int side, int maxWeight, unsigned int seed) {
+    mt19937 random(seed);
+    uniform_int_distribution<int> weight(1, maxWeight);
+    vector<int> from, to, cost;
+    for(int r = 0; r < side; r++) {
+        for(int c = 0; c < side; c++) {
+            int v = r * side + c;
+            if (c + 1 < side)
+                addBoth(v, v + 1, weight(random), from, to, cost);
+            if (r + 1 < side)
+                addBoth(v, v + side, weight(random), from, to, cost);
+        }
+    }
+    CsrGraph G;
+    G.build(side * side, from, to, cost);
+    return G;
+}
+
+CsrGraph powerLawGraph(int n, int attach, int maxWeight, unsigned int seed) {
+    mt19937 random(seed);
+    uniform_int_distribution<int> weight(1, maxWeight);
+    vector<int> from, to, cost;
+    vector<int> endpoints; // ÿߵ˵㣬оȳǰɱ
+    for(int v = 1; v < n; v++) {
+        for(int k = 0; k < attach && k < v; k++) {
+            int u = endpoints.empty() ? 0 : endpoints[random() % endpoints.size()];
+            addBoth(u, v, weight(random), from, to, cost);
+            endpoints.push_back(u);
+            endpoints.push_back(v);
+        }
+    }
+    CsrGraph G;
+    G.build(n, from, to, cost);
+    return G;
+}
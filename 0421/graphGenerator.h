@@ -0,0 +1,14 @@
+#ifndef INC_0421_GRAPHGENERATOR_H
+#define INC_0421_GRAPHGENERATOR_H
+
+#include "csrGraph.h"
+
+/*
+ * ɲõͼ߶˫ģȨֵ1maxWeight֮
+ * gridGraphside * sideƵ·ֱ
+ * powerLawGraphBarabasi-Albertӣÿ¶attachж㣬ɷֱֲС
+ */
+CsrGraph gridGraph(int side, int maxWeight, unsigned int seed);
+CsrGraph powerLawGraph(int n, int attach, int maxWeight, unsigned int seed);
+
+#endif //INC_0421_GRAPHGENERATOR_H
@@ -1,122 +1,556 @@
 #include <iostream>
-#include <fstream>
-#include <list>
+#include <vector>
+#include <chrono>
+#include <cstdint>
 #include <algorithm>
-#define INFINITY 65535
+#include <random>
+#include <functional>
+#include <memory>
+#include "csrGraph.h"
+#include "shortestPath.h"
+#include "allPairs.h"
+#include "deltaStepping.h"
+#include "graphGenerator.h"
+#include "contractionHierarchy.h"
+#include "bidirectionalSearch.h"
+#include "altSearch.h"
+#include "queryServer.h"
+#include "dynamicPaths.h"
 
 using namespace std;
-int** initGraph(string filename, int* vectorCnt); // ʼһͼ
-void Dijkstra(int** G, int n); // Dijkstra㷨·
+template<typename W>
+bool initGraph(string filename, BasicCsrGraph<W> &G); // ʼһͼ
+template<typename W>
+void Dijkstra(const BasicCsrGraph<W> &G); // Dijkstra㷨·
+template<typename W>
+int typedDijkstra(string filename); // ȨֵWͼ·
+bool allPairsShortestPath(const CsrGraph &G, string matrixFile, int threads); // ж֮·
+void deltaSteppingShortestPath(const CsrGraph &G, int delta, int threads); // -steppingԴ·
+void benchmark(int threads); // ɵͼϱȽDijkstraͦ-steppingԼDijkstraʹõļȶ
+// λشԵѯqueriesΪʱѯDijkstraȽ
+void hierarchyQueries(const CsrGraph &G, string chFile, const vector<pair<string, string>> &queries);
+// ˫DijkstraشԵѯqueriesΪʱѯDijkstraȽ
+void bidirectionalQueries(const CsrGraph &G, const vector<pair<string, string>> &queries);
+// landmarkCntرA*ALTشԵѯqueriesΪʱѯDijkstraȽ
+void altQueries(const CsrGraph &G, int landmarkCnt, int threads, const vector<pair<string, string>> &queries);
+void answerQueries(const CsrGraph &G, const vector<pair<string, string>> &queries, const PathQuery &query);
+void randomQueries(const CsrGraph &G, const PathQuery &query); // ѯʱDijkstra˶
+// פѯļʱΣlandmarkCnt0ʱALT˫Dijkstra
+bool queryServer(const CsrGraph &G, string chFile, int landmarkCnt, int threads, string socketPath);
+void dynamicBenchmark(const CsrGraph &G, int updateCnt); // ޸ıߣȽ޸ȫ
+bool loadHierarchy(const CsrGraph &G, string chFile, ContractionHierarchy &ch); // Ԥ
+template<typename W, typename D>
+void printPath(const BasicCsrGraph<W> &G, int source, int target, D dis, const vector<int> &path); // һ·
+int pathLength(const CsrGraph &G, const vector<int> &path); // ·ԭͼеĳȣһ·ʱ-1
+bool intDistancesFit(const CsrGraph &G); // int㷨ܷ֤
 
-int main() {
-    int vectorCnt; // 
-    int *(*G) = initGraph("graph.txt", &vectorCnt);
-    Dijkstra(G, vectorCnt);
+int main(int argc, char* argv[]) {
+    string filename = "graph.txt"; // ͼļ
+    bool allPairsMode = false; // Ƿж֮·
+    string matrixFile; // ӳ䵽ļ
+    int threads = 1; // ߳
+    int delta = -1; // -steppingĦС0ʾʹã0ʾԶѡ
+    bool benchMode = false; // Ƿܲ
+    string chFile; // ļ
+    bool bidirectional = false; // Ƿ˫DijkstraشԵѯ
+    int landmarkCnt = 0; // ALTĵر0ʾʹ
+    vector<pair<string, string>> queries; // Եѯյ
+    int updateCnt = 0; // ̬²Ե޸Ĵ0ʾ
+    string weightType = "int"; // Ȩ
+    bool serveMode = false; // ǷΪפѯ
+    string socketPath; // ѯUNIX׽֣Ϊʱ׼
+    // 0421 [ͼļ] [--threads N] [--all-pairs] [--matrix ļ] [--delta-stepping ] [--bench]
+    //      [--ch ļ] [--bidirectional] [--alt ر] [--query  յ]...
+    //      [--serve [--socket ׽·]] [--dynamic ޸Ĵ] [--weights int|uint32|uint64|float|double]
+    // ȨintʱֻԴ·㷨intȨֵ
+    // --queryû--chʱ˫Dijkstraش--serveʱд׼Ϣд׼
+    for(int i = 1; i < argc; i++) {
+        if (string(argv[i]) == "--threads" && i + 1 < argc)
+            threads = atoi(argv[++i]);
+        else if (string(argv[i]) == "--all-pairs")
+            allPairsMode = true;
+        else if (string(argv[i]) == "--matrix" && i + 1 < argc) {
+            allPairsMode = true;
+            matrixFile = argv[++i];
+        } else if (string(argv[i]) == "--delta-stepping" && i + 1 < argc)
+            delta = max(atoi(argv[++i]), 0);
+        else if (string(argv[i]) == "--bench")
+            benchMode = true;
+        else if (string(argv[i]) == "--ch" && i + 1 < argc)
+            chFile = argv[++i];
+        else if (string(argv[i]) == "--bidirectional")
+            bidirectional = true;
+        else if (string(argv[i]) == "--alt" && i + 1 < argc)
+            landmarkCnt = max(atoi(argv[++i]), 1);
+        else if (string(argv[i]) == "--dynamic" && i + 1 < argc)
+            updateCnt = max(atoi(argv[++i]), 1);
+        else if (string(argv[i]) == "--weights" && i + 1 < argc)
+            weightType = argv[++i];
+        else if (string(argv[i]) == "--serve")
+            serveMode = true;
+        else if (string(argv[i]) == "--socket" && i + 1 < argc) {
+            serveMode = true;
+            socketPath = argv[++i];
+        }
+        else if (string(argv[i]) == "--query" && i + 2 < argc) {
+            queries.push_back(make_pair(string(argv[i + 1]), string(argv[i + 2])));
+            i += 2;
+        }
+        else if (argv[i][0] != '-')
+            filename = argv[i];
+    }
+
+    if (benchMode) {
+        benchmark(threads);
+        return 0;
+    }
+    if (weightType == "uint32")
+        return typedDijkstra<uint32_t>(filename);
+    else if (weightType == "uint64")
+        return typedDijkstra<uint64_t>(filename);
+    else if (weightType == "float")
+        return typedDijkstra<float>(filename);
+    else if (weightType == "double")
+        return typedDijkstra<double>(filename);
+    else if (weightType != "int") {
+        cout << "ֵ֧Ȩֵ" << weightType << "" << endl;
+        return -1;
+    }
+    if (serveMode)
+        cout.rdbuf(cerr.rdbuf()); // ׼ֻѯ
+    CsrGraph G;
+    if (!initGraph(filename, G)) {
+        cout << "޷ȡļ" << filename << "" << endl;
+        return -1;
+    }
+    bool intOnly = serveMode || updateCnt > 0 || allPairsMode || !chFile.empty() || landmarkCnt > 0 ||
+                   bidirectional || !queries.empty() || delta >= 0;
+    if (intOnly && !intDistancesFit(G))
+        cout << "棺Ȩϴ·ܳintķΧ㷨ѳΧ·ڣ"
+             << "㷨ѡʱDijkstra64λ룬Ӱ" << endl;
+    if (serveMode)
+        return queryServer(G, chFile, landmarkCnt, threads, socketPath) ? 0 : -1;
+    if (updateCnt > 0)
+        dynamicBenchmark(G, updateCnt);
+    else if (allPairsMode) {
+        if (!allPairsShortestPath(G, matrixFile, threads))
+            return -1;
+    } else if (!chFile.empty())
+        hierarchyQueries(G, chFile, queries);
+    else if (landmarkCnt > 0)
+        altQueries(G, landmarkCnt, threads, queries);
+    else if (bidirectional || !queries.empty())
+        bidirectionalQueries(G, queries);
+    else if (delta >= 0)
+        deltaSteppingShortestPath(G, delta, threads);
+    else
+        Dijkstra(G);
     system("pause");
     return 0;
 }
 
-int** initGraph(string filename, int* vectorCnt) {
-    ifstream inFile;
-    inFile.open(filename, ios_base::in);
-    int x_pos = 0, y_pos = 0, weight = 0, n = 0;
-    inFile >> n;
-    int *(*G) = new int*[n];
-    for(int i = 0; i < n; i++) {
-        G[i] = new int[n];
-        for(int j = 0; j < n; j++)
-            G[i][j] = INFINITY;
-    }
-    while (!inFile.eof()) {
-        inFile >> x_pos;
-        x_pos--;
-        inFile >> y_pos;
-        y_pos--;
-        inFile >> weight;
-        G[x_pos][y_pos] = weight;
+template<typename W>
+int typedDijkstra(string filename) {
+    BasicCsrGraph<W> G;
+    if (!initGraph(filename, G)) {
+        cout << "޷ȡļ" << filename << "" << endl;
+        return -1;
+    }
+    Dijkstra(G);
+    system("pause");
+    return 0;
+}
+
+// ͼ㲻ʱڽӾ
+template<typename W>
+bool initGraph(string filename, BasicCsrGraph<W> &G) {
+    const int MATRIX_LIMIT = 30; // ڽӾ󶥵
+    if (!G.load(filename))
+        return false;
+    int n = G.vertexCount();
+    if (n > MATRIX_LIMIT) {
+        cout << "" << n << "" << G.edgeCount() << endl;
+        return true;
     }
     cout << "ڽӾΪ" << endl;
     cout << "\t";
     for(int i = 0; i < n; i++)
         cout << i + 1 << "\t";
     cout << endl;
+    const W inf = WeightTraits<W>::infinity();
+    vector<W> row(n, inf);
     for(int i = 0; i < n; i++) {
+        for(int e = G.begin(i); e < G.end(i); e++)
+            row[G.head(e)] = G.cost(e);
         cout << i + 1 << "\t";
         for(int j = 0; j < n; j++) {
-            if (G[i][j] == INFINITY) {
+            if (row[j] == inf) {
                 cout << "" << "\t";
             } else {
-                cout << G[i][j] << "\t";
+                cout << row[j] << "\t";
             }
+            row[j] = inf;
         }
         cout << endl;
     }
-    inFile.close();
-    *vectorCnt = n;
-    return G;
+    return true;
 }
 
-void Dijkstra(int** G, int n) {
+template<typename W>
+void Dijkstra(const BasicCsrGraph<W> &G) {
+    int n = G.vertexCount();
     cout << "===================ʹDijkstra㷨·===================" << endl;
-    list<int> T;
-    int* dis = new int[n];
-    string paths[n];
-    for(int i = 0; i < n; i++) {
-        dis[i] = INFINITY;
-        paths[i] = "1 --> " + to_string(i + 1);
+    typedef typename WeightTraits<W>::Distance D;
+    BasicDijkstraSearch<W> search(G);
+    search.run(0);
+    const vector<D> &dis = search.distances();
+    // ·
+    vector<int> path;
+    for(int i = 1; i < n; i++) {
+        if (search.overflowed(i)) {
+            cout << "Դ" << G.label(0) << "" << G.label(i) << "·ȳ˾͵ķΧ" << endl;
+            continue;
+        }
+        if (dis[i] == WeightTraits<D>::infinity()) {
+            cout << "Դ" << G.label(0) << "" << G.label(i) << "·" << endl;
+            continue;
+        }
+        buildPath(search.predecessors(), i, path);
+        printPath(G, 0, i, dis[i], path);
     }
-    // Step 1-ʼ
-    dis[0] = 0;
+}
+
+template<typename W, typename D>
+void printPath(const BasicCsrGraph<W> &G, int source, int target, D dis, const vector<int> &path) {
+    cout << "Դ" << G.label(source) << "" << G.label(target) << "·Ϊ" << dis << "";
+    cout << "·Ϊ";
+    for(int k = 0; k < path.size(); k++)
+        cout << (k == 0 ? "" : " --> ") << G.label(path[k]);
+    cout << endl;
+}
+
+int pathLength(const CsrGraph &G, const vector<int> &path) {
+    int length = 0;
+    for(int k = 0; k + 1 < path.size(); k++) {
+        int best = -1;
+        for(int e = G.begin(path[k]); e < G.end(path[k]); e++) {
+            if (G.head(e) == path[k + 1] && (best < 0 || G.cost(e) < best))
+                best = G.cost(e);
+        }
+        if (best < 0)
+            return -1;
+        length += best;
+    }
+    return length;
+}
+
+// ·뿪ÿһΣȲȨ֮ͣСINFʱint벻
+bool intDistancesFit(const CsrGraph &G) {
+    int64_t bound = 0;
+    for(int v = 0; v < G.vertexCount(); v++) {
+        int maxCost = 0;
+        for(int e = G.begin(v); e < G.end(v); e++)
+            maxCost = max(maxCost, G.cost(e));
+        bound += maxCost;
+        if (bound >= INF)
+            return false;
+    }
+    return true;
+}
+
+// 㲻ʱ󣬷ֻʱ
+bool allPairsShortestPath(const CsrGraph &G, string matrixFile, int threads) {
+    const int MATRIX_LIMIT = 30; // 󶥵
+    int n = G.vertexCount();
+    cout << "===================ж֮·===================" << endl;
+    DistanceMatrix matrix;
+    if (!matrix.create(n, matrixFile)) {
+        cout << "޷ļ" << matrixFile << "" << endl;
+        return false;
+    }
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    allPairs(G, matrix, threads);
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    cout << threads << "߳ʱ" << seconds << "" << endl;
+    if (!matrixFile.empty())
+        cout << "д" << matrixFile << endl;
+    if (n > MATRIX_LIMIT)
+        return true;
+    cout << "\t";
+    for(int j = 0; j < n; j++)
+        cout << G.label(j) << "\t";
+    cout << endl;
     for(int i = 0; i < n; i++) {
-        if (G[0][i] != 0) {
-            dis[i] = G[0][i];
+        cout << G.label(i) << "\t";
+        for(int j = 0; j < n; j++) {
+            if (matrix.row(i)[j] == INF)
+                cout << "" << "\t";
+            else
+                cout << matrix.row(i)[j] << "\t";
         }
+        cout << endl;
     }
-    T.push_back(1);
-    while (T.size() < n) {
-        // disеСֵ
-        int min = INFINITY, index = 0;
-        for(int i = 0; i < n; i++) {
-            bool hasVector = (find(T.begin(), T.end(), i + 1) != T.end());
-            if (dis[i] < min && !hasVector) {
-                index = i;
-                min = dis[i];
-            }
+    return true;
+}
+
+// 㲻ʱÿľ룬ֻʱͿɴĶ
+void deltaSteppingShortestPath(const CsrGraph &G, int delta, int threads) {
+    const int PRINT_LIMIT = 30; // 󶥵
+    int n = G.vertexCount();
+    cout << "===================ʹæ-stepping㷨·===================" << endl;
+    vector<int> dis;
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    deltaStepping(G, 0, delta, threads, dis);
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    if (n > PRINT_LIMIT) {
+        int reachable = n - count(dis.begin(), dis.end(), INF);
+        cout << threads << "߳ʱ" << seconds << "룬ɴĶ" << reachable << "" << endl;
+        return;
+    }
+    for(int i = 1; i < n; i++) {
+        if (dis[i] == INF)
+            cout << "Դ" << G.label(0) << "" << G.label(i) << "·" << endl;
+        else
+            cout << "Դ" << G.label(0) << "" << G.label(i) << "·Ϊ" << dis[i] << endl;
+    }
+}
+
+// ͼֱͰÿͰСͼֱСÿͰﶥ࣬ʺϲ
+void benchmark(int threads) {
+    const int MAX_WEIGHT = 100; // Ȩ
+    const int DELTAS[] = {0, 10, 50, 200}; // ԵĦ0ΪԶѡ
+    CsrGraph graphs[2] = {gridGraph(300, MAX_WEIGHT, 1), powerLawGraph(200000, 4, MAX_WEIGHT, 1)};
+    string names[2] = {"ͼ", "ͼ"};
+    cout << "===================Dijkstra릤-steppingܱȽϣ" << threads << "̣߳===================" << endl;
+    for(int g = 0; g < 2; g++) {
+        const CsrGraph &G = graphs[g];
+        cout << names[g] << "" << G.vertexCount() << "" << G.edgeCount() << endl;
+        DijkstraSearch search(G, QUEUE_HEAP); // ʵֵDijkstraȽϣԶѡͰ
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        search.run(0);
+        double base = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        cout << "\tDijkstra4ѣ" << base << "" << endl;
+        for(int d = 0; d < sizeof(DELTAS) / sizeof(DELTAS[0]); d++) {
+            vector<int> dis;
+            start = chrono::steady_clock::now();
+            deltaStepping(G, 0, DELTAS[d], threads, dis);
+            double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+            cout << "\t-stepping=" << (DELTAS[d] == 0 ? string("Զ") : to_string(DELTAS[d])) << ""
+                 << seconds << "룬ٱ" << base / seconds
+                 << (dis == search.distances() ? "һ" : "һ£") << endl;
         }
-        string newPath = paths[index];
-        //min == INFINITY ˵㷨ѾЩԴ޷
-        if (min == INFINITY) {
-            break;
+    }
+    // СȨֵʱͰ죬ȨֵʱͰ̫࣬û
+    const int QUEUE_WEIGHTS[] = {MAX_WEIGHT, 1000000}; // ԵȨ
+    const QueueKind KINDS[] = {QUEUE_HEAP, QUEUE_BUCKETS, QUEUE_RADIX};
+    const char* kindNames[] = {"Զ", "4", "Ͱ", ""};
+    cout << "===================DijkstraʹõȶбȽ===================" << endl;
+    for(int g = 0; g < 2; g++) {
+        CsrGraph G = gridGraph(300, QUEUE_WEIGHTS[g], 1);
+        DijkstraSearch automatic(G);
+        automatic.run(0);
+        cout << "ͼȨ" << QUEUE_WEIGHTS[g] << "Զѡ" << kindNames[automatic.queueKind()] << endl;
+        for(int k = 0; k < sizeof(KINDS) / sizeof(KINDS[0]); k++) {
+            DijkstraSearch search(G, KINDS[k]);
+            if (search.queueKind() != KINDS[k])
+                continue; // ͼֶ
+            chrono::steady_clock::time_point start = chrono::steady_clock::now();
+            search.run(0);
+            double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+            cout << "\t" << kindNames[KINDS[k]] << "" << seconds << ""
+                 << (search.distances() == automatic.distances() ? "һ" : "һ£") << endl;
         }
-        // ŵT
-        T.push_back(index + 1);
-        // dis
-        for(int i = 0; i < n; i++) {
-            if (G[index][i] != INFINITY) {
-                if (min + G[index][i] < dis[i]) {
-                    dis[i] = min + G[index][i];
-                    paths[i] = newPath + " --> " + to_string(i + 1);
-                }
-            }
+    }
+}
+
+// ԵһΪԴ㣬ȨֵСӱߡɾߣÿ޸ĺֱʱ޸ȫ㣬ȽϽ
+void dynamicBenchmark(const CsrGraph &G, int updateCnt) {
+    const int MAX_WEIGHT = 100; // Ȩֵ
+    cout << "===================̬޸ıߺ޸·===================" << endl;
+    if (G.vertexCount() == 0)
+        return;
+    DynamicShortestPaths paths(G, 0);
+    mt19937 random(1);
+    uniform_int_distribution<int> vertex(0, G.vertexCount() - 1), weight(1, MAX_WEIGHT), kind(0, 3);
+    vector<int> full;
+    double repairSeconds = 0, fullSeconds = 0;
+    long long changed = 0; // ۼƱ仯Ķ
+    int wrong = 0;
+    for(int q = 0; q < updateCnt; q++) {
+        int u = vertex(random), type = kind(random);
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        if (type == 3 || paths.outDegree(u) == 0)
+            changed += paths.insertEdge(u, vertex(random), weight(random));
+        else {
+            int v = paths.outArc(u, uniform_int_distribution<int>(0, paths.outDegree(u) - 1)(random)).vertex;
+            changed += type == 2 ? paths.deleteEdge(u, v) : paths.setWeight(u, v, weight(random));
         }
+        repairSeconds += chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        start = chrono::steady_clock::now();
+        paths.recompute(full);
+        fullSeconds += chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        if (full != paths.distances())
+            wrong++;
     }
-    // ·
-    for(int i = 0; i < paths->size() - 1; i++) {
-        replace(paths[i].begin(), paths[i].end(), '1', 's');
-        replace(paths[i].begin(), paths[i].end(), '2', 'a');
-        replace(paths[i].begin(), paths[i].end(), '3', 'b');
-        replace(paths[i].begin(), paths[i].end(), '4', 'e');
-        replace(paths[i].begin(), paths[i].end(), '5', 'd');
-        replace(paths[i].begin(), paths[i].end(), '6', 'c');
-        if (i == 0)
+    cout << "޸" << updateCnt << "Σ޸ƽ" << repairSeconds / updateCnt * 1e6 << "΢루ƽ"
+         << (double)changed / updateCnt << "仯ȫƽ" << fullSeconds / updateCnt * 1e6
+         << "΢룬ٱ" << fullSeconds / max(repairSeconds, 1e-9) << "" << wrong << "νһ" << endl;
+}
+
+void hierarchyQueries(const CsrGraph &G, string chFile, const vector<pair<string, string>> &queries) {
+    cout << "===================ʹμԵ·===================" << endl;
+    ContractionHierarchy ch;
+    loadHierarchy(G, chFile, ch);
+    ChSearch search(ch);
+    PathQuery query = [&](int source, int target, vector<int>* path) {
+        return search.query(source, target, path);
+    };
+    answerQueries(G, queries, query);
+    if (queries.empty())
+        randomQueries(G, query);
+}
+
+void bidirectionalQueries(const CsrGraph &G, const vector<pair<string, string>> &queries) {
+    cout << "===================ʹ˫DijkstraԵ·===================" << endl;
+    CsrGraph reverse = G.reversed();
+    BidirectionalSearch search(G, reverse);
+    long long settled = 0; // ۼȷĶ
+    int queryCnt = 0;
+    PathQuery query = [&](int source, int target, vector<int>* path) {
+        int dis = search.query(source, target, path);
+        settled += search.settledCount();
+        queryCnt++;
+        return dis;
+    };
+    answerQueries(G, queries, query);
+    if (queries.empty()) {
+        randomQueries(G, query);
+        cout << "ƽÿβѯȷ" << (double)settled / max(queryCnt, 1) << "㣨DijkstraΪ"
+             << G.vertexCount() << "" << endl;
+    }
+}
+
+// ļҶӦͼʱֱӶ룬Ԥ󱣴棬ʧʱfalse
+bool loadHierarchy(const CsrGraph &G, string chFile, ContractionHierarchy &ch) {
+    if (ch.load(chFile, G)) {
+        cout << "Ѵ" << chFile << "" << endl;
+        return true;
+    }
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    ch.build(G);
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    cout << "Ԥʱ" << seconds << "룬" << ch.shortcutCount() << "ݾ" << endl;
+    if (!ch.save(chFile)) {
+        cout << "޷дļ" << chFile << "" << endl;
+        return false;
+    }
+    return true;
+}
+
+// ÿ߳һѯ󣬹ֻΡͼر
+bool queryServer(const CsrGraph &G, string chFile, int landmarkCnt, int threads, string socketPath) {
+    ContractionHierarchy ch;
+    CsrGraph reverse;
+    Landmarks landmarks;
+    QueryFactory factory;
+    if (!chFile.empty()) {
+        loadHierarchy(G, chFile, ch);
+        factory = [&]() {
+            shared_ptr<ChSearch> search = make_shared<ChSearch>(ch);
+            return PathQuery([search](int source, int target, vector<int>* path) {
+                return search->query(source, target, path);
+            });
+        };
+    } else {
+        reverse = G.reversed();
+        if (landmarkCnt > 0) {
+            landmarks.build(G, reverse, landmarkCnt, threads);
+            factory = [&]() {
+                shared_ptr<AltSearch> search = make_shared<AltSearch>(G, landmarks);
+                return PathQuery([search](int source, int target, vector<int>* path) {
+                    return search->query(source, target, path);
+                });
+            };
+        } else {
+            factory = [&]() {
+                shared_ptr<BidirectionalSearch> search = make_shared<BidirectionalSearch>(G, reverse);
+                return PathQuery([search](int source, int target, vector<int>* path) {
+                    return search->query(source, target, path);
+                });
+            };
+        }
+    }
+    return serveQueries(G, factory, threads, socketPath);
+}
+
+// رľڶͼ㣬浽ļ
+void altQueries(const CsrGraph &G, int landmarkCnt, int threads, const vector<pair<string, string>> &queries) {
+    cout << "===================ʹA*" << landmarkCnt << "ر꣩Ե·===================" << endl;
+    CsrGraph reverse = G.reversed();
+    Landmarks landmarks;
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    landmarks.build(G, reverse, landmarkCnt, threads);
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    cout << "ѡر겢ʱ" << seconds << "" << endl;
+    AltSearch search(G, landmarks);
+    long long settled = 0; // ۼȷĶ
+    int queryCnt = 0;
+    PathQuery query = [&](int source, int target, vector<int>* path) {
+        int dis = search.query(source, target, path);
+        settled += search.settledCount();
+        queryCnt++;
+        return dis;
+    };
+    answerQueries(G, queries, query);
+    if (queries.empty()) {
+        randomQueries(G, query);
+        cout << "ƽÿβѯȷ" << (double)settled / max(queryCnt, 1) << "㣨DijkstraΪ"
+             << G.vertexCount() << "" << endl;
+    }
+}
+
+// ƻشѯ·
+void answerQueries(const CsrGraph &G, const vector<pair<string, string>> &queries, const PathQuery &query) {
+    vector<int> path;
+    for(int q = 0; q < queries.size(); q++) {
+        int source = G.find(queries[q].first), target = G.find(queries[q].second);
+        if (source < 0 || target < 0) {
+            cout << "ûж" << (source < 0 ? queries[q].first : queries[q].second) << "" << endl;
             continue;
-        else {
-            if (dis[i] == INFINITY) {
-                cout << "Դs" << paths[i][paths[i].size() - 1] << "·" << endl;
-            } else {
-                cout << "Դs" << paths[i][paths[i].size() - 1] << "·Ϊ" << dis[i] << "";
-                cout << "·Ϊ" << paths[i] << endl;
-            }
         }
+        int dis = query(source, target, &path);
+        if (dis == INF)
+            cout << "Դ" << G.label(source) << "" << G.label(target) << "·" << endl;
+        else
+            printPath(G, source, target, dis, path);
+    }
+}
+
+// ѯʱǰCHECK_QUERIESDijkstra˶Ծ·
+void randomQueries(const CsrGraph &G, const PathQuery &query) {
+    const int RANDOM_QUERIES = 10000; // ѯĴ
+    const int CHECK_QUERIES = 100; // Dijkstra˶ԵĴ
+    if (G.vertexCount() == 0)
+        return;
+    mt19937 random(1);
+    uniform_int_distribution<int> vertex(0, G.vertexCount() - 1);
+    DijkstraSearch search(G);
+    vector<int> path;
+    int wrong = 0;
+    for(int q = 0; q < CHECK_QUERIES; q++) {
+        int source = vertex(random), target = vertex(random);
+        search.run(source);
+        int dis = query(source, target, &path);
+        if (dis != search.distance(target) || (dis != INF && pathLength(G, path) != dis))
+            wrong++;
+    }
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    long long checksum = 0;
+    for(int q = 0; q < RANDOM_QUERIES; q++) {
+        int source = vertex(random), target = vertex(random);
+        checksum += query(source, target, NULL);
     }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    cout << "ѯ" << RANDOM_QUERIES << "Σƽÿ" << seconds / RANDOM_QUERIES * 1e6 << "΢루У"
+         << checksum << "Dijkstra˶" << CHECK_QUERIES << "Σ" << wrong << "βһ" << endl;
 }
@@ -0,0 +1,166 @@
+#include "queryServer.h"
+#include "shortestPath.h"
+#include "threadPool.h"
+#include <atomic>
+#include <iostream>
+#include <chrono>
+#include <thread>
+#include <cerrno>
+#include <cstring>
+#include <algorithm>
+#ifndef _WIN32
+#include <unistd.h>
+#include <csignal>
+#include <sys/socket.h>
+#include <sys/un.h>
+#endif
+
+const int BATCH_SIZE = 4096; // һĲѯ
+const int CHUNK = 16; // ߳ÿȡĲѯ
+const int MAX_BACKOFF_MS = 1000; // acceptʧʱĵȴʱ
+
+#ifndef _WIN32
+// ļϰжԴ
+class LineReader {
+public:
+    explicit LineReader(int fd) : fd(fd), start(0), end(0) {};
+    bool readLine(string &line); // һУзβûʣʱfalse
+private:
+    int fd;
+    char buffer[1 << 16];
+    int start, end; // лûĲ
+};
+
+bool LineReader::readLine(string &line) {
+    line.clear();
+    while (true) {
+        for(int i = start; i < end; i++) {
+            if (buffer[i] == '\n') {
+                line.append(buffer + start, i - start);
+                start = i + 1;
+                if (!line.empty() && line.back() == '\r')
+                    line.pop_back();
+                return true;
+            }
+        }
+        line.append(buffer + start, end - start);
+        start = end = 0;
+        ssize_t got = read(fd, buffer, sizeof(buffer));
+        if (got <= 0)
+            return !line.empty();
+        end = got;
+    }
+}
+
+static bool writeAll(int fd, const string &data) {
+    size_t written = 0;
+    while (written < data.size()) {
+        ssize_t n = write(fd, data.data() + written, data.size() - written);
+        if (n <= 0)
+            return false;
+        written += n;
+    }
+    return true;
+}
+
+// شһевѯ
+static void serveStream(const CsrGraph &G, vector<PathQuery> &engines, ThreadPool &pool, int in, int out) {
+    LineReader reader(in);
+    vector<string> sources, targets;
+    vector<int> from, to, result;
+    string line;
+    bool more = true;
+    while (more) {
+        sources.clear();
+        targets.clear();
+        while (sources.size() < BATCH_SIZE && (more = reader.readLine(line)) && !line.empty()) {
+            size_t split = line.find_first_of(" \t");
+            size_t second = line.find_first_not_of(" \t", split);
+            if (split == string::npos || second == string::npos)
+                continue;
+            sources.push_back(line.substr(0, split));
+            targets.push_back(line.substr(second, line.find_first_of(" \t", second) - second));
+        }
+        int cnt = sources.size();
+        if (cnt == 0)
+            continue;
+        from.resize(cnt);
+        to.resize(cnt);
+        result.assign(cnt, -1);
+        for(int q = 0; q < cnt; q++) {
+            from[q] = G.find(sources[q]);
+            to[q] = G.find(targets[q]);
+        }
+        atomic<int> next(0);
+        pool.parallelFor(pool.size(), [&](int worker) {
+            PathQuery &query = engines[worker];
+            while (true) {
+                int first = next.fetch_add(CHUNK);
+                if (first >= cnt)
+                    break;
+                for(int q = first; q < first + CHUNK && q < cnt; q++) {
+                    if (from[q] < 0 || to[q] < 0)
+                        continue;
+                    int dis = query(from[q], to[q], NULL);
+                    result[q] = dis == INF ? -1 : dis;
+                }
+            }
+        });
+        string output;
+        for(int q = 0; q < cnt; q++)
+            output += sources[q] + " " + targets[q] + " " + to_string(result[q]) + "\n";
+        if (!writeAll(out, output))
+            return;
+    }
+}
+#endif
+
+bool serveQueries(const CsrGraph &G, const QueryFactory &factory, int threads, string socketPath) {
+#ifdef _WIN32
+    cerr << "ѯֻ֧POSIXϵͳ" << endl;
+    return false;
+#else
+    ThreadPool pool(threads);
+    vector<PathQuery> engines;
+    for(int i = 0; i < pool.size(); i++)
+        engines.push_back(factory());
+    if (socketPath.empty()) {
+        serveStream(G, engines, pool, STDIN_FILENO, STDOUT_FILENO);
+        return true;
+    }
+
+    sockaddr_un address = {};
+    if (socketPath.size() >= sizeof(address.sun_path)) {
+        cerr << "׽·̫" << socketPath << endl;
+        return false;
+    }
+    signal(SIGPIPE, SIG_IGN); // ͻǰϿʱwriteش󣬶ǽ
+    address.sun_family = AF_UNIX;
+    socketPath.copy(address.sun_path, socketPath.size());
+    int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    unlink(socketPath.c_str());
+    if (listener < 0 || bind(listener, (sockaddr*)&address, sizeof(address)) < 0 || listen(listener, 16) < 0) {
+        cerr << "޷" << socketPath << endl;
+        if (listener >= 0)
+            close(listener);
+        return false;
+    }
+    cerr << "" << socketPath << "ϵȴѯ" << endl;
+    int backoff = 0; // acceptʧܺȴĺʧʱӱ
+    while (true) {
+        int client = accept(listener, NULL, NULL);
+        if (client < 0) {
+            if (errno == EINTR || errno == ECONNABORTED)
+                continue;
+            // ļ꣨EMFILEȴ󲻻ʧһԣת
+            backoff = backoff == 0 ? 10 : min(backoff * 2, MAX_BACKOFF_MS);
+            cerr << "acceptʧܣ" << strerror(errno) << "" << backoff << "" << endl;
+            this_thread::sleep_for(chrono::milliseconds(backoff));
+            continue;
+        }
+        backoff = 0;
+        serveStream(G, engines, pool, client, client);
+        close(client);
+    }
+#endif
+}
@@ -0,0 +1,22 @@
+#ifndef INC_0421_QUERYSERVER_H
+#define INC_0421_QUERYSERVER_H
+
+#include <string>
+#include <vector>
+#include <functional>
+#include "csrGraph.h"
+
+using namespace std;
+
+typedef function<int(int, int, vector<int>*)> PathQuery; // Եѯ㡢յ㡢·ΪNULLؾ
+typedef function<PathQuery()> QueryFactory; // ÿ̵߳һΣõԼ״̬Ĳѯ
+
+/*
+ * פĲѯͼֻһΣÿ̵ֻ߳һΣ֮ÿβѯ״̬·䡢㡣
+ * ÿһѯ" յ"ƣBATCH_SIZEСлβʱΪһ
+ * ̳߳е̲߳شٰ˳ÿ" յ "ɴûʱΪ-1
+ * socketPathΪʱӱ׼д׼βʱأUNIX׽νӣء
+ */
+bool serveQueries(const CsrGraph &G, const QueryFactory &factory, int threads, string socketPath = "");
+
+#endif //INC_0421_QUERYSERVER_H
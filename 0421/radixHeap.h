@@ -0,0 +1,160 @@
+#ifndef INC_0421_RADIXHEAP_H
+#define INC_0421_RADIXHEAP_H
+
+#include <vector>
+#include <cstdint>
+
+using namespace std;
+
+/*
+ * ѣӿDAryHeapͬkeyΪǸֻڵkeyĳϣDijkstra
+ * һεkeyΪlastkeyŽbͰbΪkeylastߵĲͬλλü1ͬʱΪ0
+ * 0ͰʱҵһǿյͰȡСkeyΪµlastͰԪ·ֵСͰ
+ * ÿԪֻСͰƶܴO(m + n log C)ȨCĴС޹أʺȨֵΧͼ
+ * decreaseKeyƶԪأٷһµģɵ·Ͱ򵯳ʱkeys
+ */
+template<typename Key>
+class RadixHeap {
+public:
+    RadixHeap() : last(0), count(0) {};
+    explicit RadixHeap(int n) : last(0), count(0) { reset(n); };
+    void reset(int n); // ŷΧΪ0..n-1
+    bool empty() const { return count == 0; };
+    int size() const { return count; };
+    bool contains(int v) const { return queued[v]; };
+    Key topKey() const { refill(); return (Key)last; }; // Сkey
+    int top() const { refill(); return buckets[0].back().vertex; }; // keyСһ
+    void push(int v, Key key); // 벻ڶеĶ
+    void decreaseKey(int v, Key key); // ѶжkeyСkey
+    bool pushOrDecrease(int v, Key key); // ڶʱ룬ڶkeyСʱСǷб仯
+    int pop(); // keyСһ
+    void clear(); // ն
+private:
+    static const int BUCKETS = 65; // uint64_t64λϵ0Ͱ
+    struct Entry {
+        uint64_t key;
+        int vertex;
+    };
+    mutable vector<Entry> buckets[BUCKETS];
+    vector<Key> keys; // ж㵱ǰkey
+    vector<char> queued; // Ƿڶ
+    mutable uint64_t last; // һεkeyڶеkey
+    int count; // еĶ
+
+    static int bucketOf(uint64_t key, uint64_t last); // keyӦͰ
+    bool live(const Entry &entry) const { return queued[entry.vertex] && (uint64_t)keys[entry.vertex] == entry.key; };
+    void refill() const; // õ0ͰĩβһЧСԪ
+};
+
+template<typename Key>
+void RadixHeap<Key>::reset(int n) {
+    clear();
+    keys.assign(n, 0);
+    queued.assign(n, 0);
+}
+
+template<typename Key>
+int RadixHeap<Key>::bucketOf(uint64_t key, uint64_t last) {
+    uint64_t diff = key ^ last;
+    if (diff == 0)
+        return 0;
+#if defined(__GNUC__) || defined(__clang__)
+    return 64 - __builtin_clzll(diff);
+#else
+    int b = 0;
+    while (diff != 0) {
+        diff >>= 1;
+        b++;
+    }
+    return b;
+#endif
+}
+
+template<typename Key>
+void RadixHeap<Key>::refill() const {
+    while (true) {
+        while (!buckets[0].empty() && !live(buckets[0].back()))
+            buckets[0].pop_back();
+        if (!buckets[0].empty())
+            return;
+        int i = 1;
+        while (buckets[i].empty())
+            i++;
+        // ڵԪأȡЧԪСkeyΪµlast·Ͱ
+        vector<Entry> &bucket = buckets[i];
+        uint64_t min = UINT64_MAX;
+        int kept = 0;
+        for(int k = 0; k < bucket.size(); k++) {
+            if (!live(bucket[k]))
+                continue;
+            bucket[kept++] = bucket[k];
+            if (bucket[k].key < min)
+                min = bucket[k].key;
+        }
+        bucket.resize(kept);
+        if (kept == 0)
+            continue;
+        last = min;
+        for(int k = 0; k < bucket.size(); k++)
+            buckets[bucketOf(bucket[k].key, last)].push_back(bucket[k]);
+        bucket.clear();
+    }
+}
+
+template<typename Key>
+void RadixHeap<Key>::push(int v, Key key) {
+    if (count == 0)
+        last = key;
+    keys[v] = key;
+    queued[v] = 1;
+    count++;
+    Entry entry;
+    entry.key = key;
+    entry.vertex = v;
+    buckets[bucketOf(key, last)].push_back(entry);
+}
+
+template<typename Key>
+void RadixHeap<Key>::decreaseKey(int v, Key key) {
+    keys[v] = key;
+    Entry entry;
+    entry.key = key;
+    entry.vertex = v;
+    buckets[bucketOf(key, last)].push_back(entry);
+}
+
+template<typename Key>
+bool RadixHeap<Key>::pushOrDecrease(int v, Key key) {
+    if (!queued[v]) {
+        push(v, key);
+        return true;
+    }
+    if (key < keys[v]) {
+        decreaseKey(v, key);
+        return true;
+    }
+    return false;
+}
+
+template<typename Key>
+int RadixHeap<Key>::pop() {
+    refill();
+    int v = buckets[0].back().vertex;
+    buckets[0].pop_back();
+    queued[v] = 0;
+    count--;
+    return v;
+}
+
+template<typename Key>
+void RadixHeap<Key>::clear() {
+    for(int b = 0; b < BUCKETS; b++) {
+        for(int k = 0; k < buckets[b].size(); k++)
+            queued[buckets[b][k].vertex] = 0;
+        buckets[b].clear();
+    }
+    last = 0;
+    count = 0;
+}
+
+#endif //INC_0421_RADIXHEAP_H
@@ -0,0 +1,92 @@
+#include "shortestPath.h"
+#include <algorithm>
+#include <cstdint>
+
+template<typename W, typename D>
+BasicDijkstraSearch<W, D>::BasicDijkstraSearch(const BasicCsrGraph<W> &G, QueueKind kind)
+        : G(G), heap(0), kind(kind), dis(G.vertexCount()), pred(G.vertexCount()),
+          settled(G.vertexCount()), tooLong(G.vertexCount()) {
+    prepare(integral_constant<bool, WeightTraits<W>::integral>());
+}
+
+template<typename W, typename D>
+void BasicDijkstraSearch<W, D>::prepare(true_type) {
+    W maxWeight = G.maxCost();
+    if (kind == QUEUE_BUCKETS && maxWeight >= MAX_BUCKETS)
+        kind = QUEUE_AUTO;
+    if (kind == QUEUE_AUTO)
+        kind = maxWeight < MAX_BUCKETS ? QUEUE_BUCKETS : QUEUE_RADIX;
+    if (kind == QUEUE_BUCKETS)
+        buckets.reset(G.vertexCount(), (D)maxWeight);
+    else if (kind == QUEUE_RADIX)
+        radix.reset(G.vertexCount());
+    else
+        heap = DAryHeap<D>(G.vertexCount());
+}
+
+template<typename W, typename D>
+void BasicDijkstraSearch<W, D>::prepare(false_type) {
+    kind = QUEUE_HEAP;
+    heap = DAryHeap<D>(G.vertexCount());
+}
+
+template<typename W, typename D>
+void BasicDijkstraSearch<W, D>::dispatch(int source, true_type) {
+    if (kind == QUEUE_BUCKETS)
+        search(buckets, source);
+    else if (kind == QUEUE_RADIX)
+        search(radix, source);
+    else
+        search(heap, source);
+}
+
+template<typename W, typename D>
+void BasicDijkstraSearch<W, D>::run(int source) {
+    fill(dis.begin(), dis.end(), WeightTraits<D>::infinity());
+    fill(pred.begin(), pred.end(), -1);
+    fill(settled.begin(), settled.end(), false);
+    fill(tooLong.begin(), tooLong.end(), false);
+    dispatch(source, integral_constant<bool, WeightTraits<W>::integral>());
+}
+
+template<typename W, typename D>
+template<typename Queue>
+void BasicDijkstraSearch<W, D>::search(Queue &queue, int source) {
+    queue.clear();
+    dis[source] = 0;
+    queue.push(source, 0);
+    while (!queue.empty()) {
+        // ȡdisСĶ
+        D min = queue.topKey();
+        int index = queue.pop();
+        settled[index] = true;
+        // disminޣӵõinfinity()˵DķΧ
+        for(int e = G.begin(index); e < G.end(index); e++) {
+            int i = G.head(e);
+            D nd = WeightTraits<D>::add(min, G.cost(e));
+            if (nd == WeightTraits<D>::infinity()) {
+                tooLong[i] = true;
+                continue;
+            }
+            if (!settled[i] && nd < dis[i]) {
+                dis[i] = nd;
+                pred[i] = index;
+                queue.pushOrDecrease(i, nd);
+            }
+        }
+    }
+}
+
+template class BasicDijkstraSearch<int, int>;
+template class BasicDijkstraSearch<int, int64_t>;
+template class BasicDijkstraSearch<uint32_t, uint64_t>;
+template class BasicDijkstraSearch<uint64_t, uint64_t>;
+template class BasicDijkstraSearch<float, float>;
+template class BasicDijkstraSearch<double, double>;
+
+void buildPath(const vector<int> &pred, int target, vector<int> &buffer) {
+    buffer.clear();
+    for(int v = target; v >= 0; v = pred[v])
+        buffer.push_back(v);
+    reverse(buffer.begin(), buffer.end());
+}
@@ -0,0 +1,70 @@
+#ifndef INC_0421_SHORTESTPATH_H
+#define INC_0421_SHORTESTPATH_H
+
+#include <vector>
+#include <type_traits>
+#include "csrGraph.h"
+#include "dAryHeap.h"
+#include "bucketQueue.h"
+#include "radixHeap.h"
+#include "weightTraits.h"
+
+using namespace std;
+
+const int INF = WeightTraits<int>::infinity(); // intȨֵʱɴﶥľ
+
+/* Dijkstraʹõȶ */
+enum QueueKind {
+    QUEUE_AUTO, // ȨֵͺͷΧԶѡ
+    QUEUE_HEAP, // 4
+    QUEUE_BUCKETS, // DialͰУֻȨֵȨСMAX_BUCKETS
+    QUEUE_RADIX // ѣֻȨֵ
+};
+
+/*
+ * ԴDijkstraСdispredsettledڶrun֮临ã·䡣
+ * ڱʱȨֵѡ񣺸ȨֵֻDѣȨֵԶѡʱȨC
+ * CСMAX_BUCKETSʱDialͰУO(m + nC)Ͱʱ죩ûѣO(m + n log C)
+ * ָĶвͼʱԶѡ
+ * DۼӣĬΪWeightTraits<W>::Distanceintuint32_tıȨ64λ룩ӷ͵infinity()
+ * ֻܾDΧ·Ķoverflowed֣ᵱɴ
+ * WDshortestPath.cppʽʵһֻһ߳ʹã߳ʱÿ߳һ
+ */
+template<typename W, typename D = typename WeightTraits<W>::Distance>
+class BasicDijkstraSearch {
+public:
+    static const int MAX_BUCKETS = 1 << 16; // ͰͰ
+    explicit BasicDijkstraSearch(const BasicCsrGraph<W> &G, QueueKind kind = QUEUE_AUTO);
+    void run(int source); // sourceж·
+    D distance(int v) const { return dis[v]; }; // vľ룬ɴ򳬳DķΧʱΪWeightTraits<D>::infinity()
+    bool overflowed(int v) const { return dis[v] == WeightTraits<D>::infinity() && tooLong[v]; }; // v·DķΧ
+    int predecessor(int v) const { return pred[v]; }; // ·vǰһ㣬-1ʾû
+    const vector<D> &distances() const { return dis; };
+    const vector<int> &predecessors() const { return pred; };
+    QueueKind queueKind() const { return kind; }; // ʵʹõĶ
+private:
+    const BasicCsrGraph<W> &G;
+    // ֶֻkindӦһַ˿ռ
+    DAryHeap<D> heap; // disĺѡ
+    BucketQueue<D> buckets; // ȨֵȨʱheap
+    RadixHeap<D> radix; // ȨֵȨʱheap
+    QueueKind kind;
+    vector<D> dis; // 
+    vector<int> pred; // ǰ
+    vector<bool> settled; // Ѿ·Ķ
+    vector<bool> tooLong; // һ·DķΧ
+
+    void prepare(true_type); // ȨֵȨѡ
+    void prepare(false_type); // Ȩֵֻö
+    void dispatch(int source, true_type); // kindѡ
+    void dispatch(int source, false_type) { search(heap, source); };
+    template<typename Queue>
+    void search(Queue &queue, int source);
+};
+
+typedef BasicDijkstraSearch<int, int> DijkstraSearch; // int룬ΡALTint㷨˶ԺԤ
+
+// ǰtarget߻Դ㣬·ϵĶ㰴Դ㿪ʼ˳Žbufferbufferڶεü临
+void buildPath(const vector<int> &pred, int target, vector<int> &buffer);
+
+#endif //INC_0421_SHORTESTPATH_H
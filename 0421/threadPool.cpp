@@ -0,0 +1,71 @@
+#include "threadPool.h"
+
+ThreadPool::ThreadPool(int threads) {
+    job = NULL;
+    jobCnt = 0;
+    next = 0;
+    busy = 0;
+    generation = 0;
+    stopping = false;
+    for(int i = 1; i < threads; i++)
+        workers.push_back(thread(&ThreadPool::workerLoop, this));
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        unique_lock<mutex> guard(lock);
+        stopping = true;
+    }
+    wake.notify_all();
+    for(int i = 0; i < workers.size(); i++)
+        workers[i].join();
+}
+
+void ThreadPool::runTasks() {
+    while (true) {
+        int index = next.fetch_add(1);
+        if (index >= jobCnt)
+            break;
+        (*job)(index);
+    }
+}
+
+void ThreadPool::workerLoop() {
+    int seen = 0;
+    while (true) {
+        {
+            unique_lock<mutex> guard(lock);
+            wake.wait(guard, [&] { return stopping || generation != seen; });
+            if (stopping)
+                return;
+            seen = generation;
+        }
+        runTasks();
+        {
+            unique_lock<mutex> guard(lock);
+            if (--busy == 0)
+                done.notify_one();
+        }
+    }
+}
+
+void ThreadPool::parallelFor(int taskCnt, const function<void(int)> &task) {
+    if (workers.empty() || taskCnt <= 1) {
+        for(int i = 0; i < taskCnt; i++)
+            task(i);
+        return;
+    }
+    {
+        unique_lock<mutex> guard(lock);
+        job = &task;
+        jobCnt = taskCnt;
+        next = 0;
+        busy = workers.size();
+        generation++;
+    }
+    wake.notify_all();
+    runTasks();
+    unique_lock<mutex> guard(lock);
+    done.wait(guard, [&] { return busy == 0; });
+    job = NULL;
+}
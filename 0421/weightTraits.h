@@ -0,0 +1,45 @@
+#ifndef INC_0421_WEIGHTTRAITS_H
+#define INC_0421_WEIGHTTRAITS_H
+
+#include <limits>
+#include <cstdint>
+
+using namespace std;
+
+// ۼWͱȨõľͣintuint32_t64λ2^31ʱļ·Ҳ
+template<typename W>
+struct WideDistance {
+    typedef W type;
+};
+
+template<>
+struct WideDistance<int> {
+    typedef int64_t type;
+};
+
+template<>
+struct WideDistance<uint32_t> {
+    typedef uint64_t type;
+};
+
+/*
+ * Ȩ;Wԡɴľ룺ΪΪֵȨΪ
+ * ļӷ͵infinity()ƻسС͵Ľ벻ɴͬ
+ * Ҫʱ·̫ǲڣڽΪinfinity()ʱǷޣBasicDijkstraSearch::overflowed
+ */
+template<typename W>
+struct WeightTraits {
+    typedef typename WideDistance<W>::type Distance; // ۼӾ
+    static const bool integral = numeric_limits<W>::is_integer; // ȨֵͰ
+    static constexpr W infinity() {
+        return numeric_limits<W>::has_infinity ? numeric_limits<W>::infinity() : numeric_limits<W>::max();
+    };
+    // a + baΪinfinity()ΧʱΪinfinity()
+    static W add(W a, W b) {
+        if (!integral)
+            return a + b;
+        return a == infinity() || (b > 0 && a > infinity() - b) ? infinity() : a + b;
+    };
+};
+
+#endif //INC_0421_WEIGHTTRAITS_H